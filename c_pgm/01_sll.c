@@ -1,5 +1,14 @@
 #include <stdio.h>
 #include <stdlib.h>
+#include "instrument.h"
+#include "fastout.h"
+#include "bloom.h"
+
+// Set to 1 to find values through a hash index instead of a linear
+// scan. Off by default because it changes Delete by Value: see there.
+#ifndef USE_VALUE_INDEX
+#define USE_VALUE_INDEX 0
+#endif
 
 // Structure definition for a node in the linked list
 struct Node {
@@ -7,10 +16,37 @@ struct Node {
     struct Node *next;     // Pointer to the next node
 };
 
+STATS_DEFINE("singly_linked_list");
+
+// Filter of the values in the list (no-op unless compiled with -DBLOOM_FILTER)
+BLOOM_DEFINE();
+
+#if USE_VALUE_INDEX
+#include "valueindex.h"
+#endif
+
+// List handle: the first node plus the value index of this list, so
+// several lists can each keep their own index
+struct List {
+    struct Node* head;  // First node
+#if USE_VALUE_INDEX
+    struct ValueIndex index;  // value -> node, kept in sync with the list
+#endif
+};
+
+// Function to initialize an empty list
+void createList(struct List* list) {
+    list->head = NULL;
+#if USE_VALUE_INDEX
+    initIndex(&list->index, 16);
+#endif
+}
+
 // Function to create a new node with given data
 struct Node* createNode(int value) {
     // Dynamically allocate memory for a new node
     struct Node* newNode = (struct Node*) malloc(sizeof(struct Node));
+    STAT_ALLOC(sizeof(struct Node));
 
     // Assign the value to the data field
     newNode->data = value;
@@ -18,61 +54,78 @@ struct Node* createNode(int value) {
     // Initially, the next pointer is set to NULL (no link yet)
     newNode->next = NULL;
 
+    // Every node is created to be linked in, so its value is added here
+    BLOOM_ADD(value);
+
     // Return the address of the new node
     return newNode;
 }
 
 // Function to insert a new node at the beginning of the list
-void insertAtBeginning(struct Node** head, int value) {
+void insertAtBeginning(struct List* list, int value) {
     // Create a new node
     struct Node* newNode = createNode(value);
 
     // Make the new node point to the current head
-    newNode->next = *head;
+    newNode->next = list->head;
 
     // Move the head pointer to the new node
-    *head = newNode;
+    list->head = newNode;
+
+#if USE_VALUE_INDEX
+    indexInsert(&list->index, value, newNode);
+#endif
 
     printf("Node inserted at beginning.\n");
 }
 
 // Function to insert a new node at the end of the list
-void insertAtEnd(struct Node** head, int value) {
+void insertAtEnd(struct List* list, int value) {
     // Create a new node
     struct Node* newNode = createNode(value);
 
     // If the list is empty, new node becomes the head
-    if (*head == NULL) {
-        *head = newNode;
+    if (list->head == NULL) {
+        list->head = newNode;
     } 
     else {
         // Otherwise, traverse the list until the last node
-        struct Node* temp = *head;
-        while (temp->next != NULL)
+        struct Node* temp = list->head;
+        while (temp->next != NULL) {
+            STAT_VISIT();
             temp = temp->next;
+        }
 
         // Link the last node to the new node
         temp->next = newNode;
     }
 
+#if USE_VALUE_INDEX
+    indexInsert(&list->index, value, newNode);
+#endif
+
     printf("Node inserted at end.\n");
 }
 
 // Function to insert a node after a given position
-void insertAfterPosition(struct Node* head, int position, int value) {
+void insertAfterPosition(struct List* list, int position, int value) {
     // Create a new node
     struct Node* newNode = createNode(value);
-    struct Node* temp = head;
+    struct Node* temp = list->head;
     int i;
 
     // Traverse the list until the given position
-    for (i = 1; i < position && temp != NULL; i++)
+    for (i = 1; i < position && temp != NULL; i++) {
+        STAT_VISIT();
         temp = temp->next;
+    }
 
     // If the position is invalid (list ended early)
     if (temp == NULL) {
         printf("Position not found.\n");
         free(newNode); // free the unused node memory
+        STAT_FREE(sizeof(struct Node));
+        BLOOM_REMOVED();
         return;
     }
 
@@ -80,84 +133,305 @@ void insertAfterPosition(struct Node* head, int position, int value) {
     newNode->next = temp->next;
     temp->next = newNode;
 
+#if USE_VALUE_INDEX
+    indexInsert(&list->index, value, newNode);
+#endif
+
     printf("Node inserted after position %d.\n", position);
 }
 
 // Function to delete a node from the beginning
-void deleteFromBeginning(struct Node** head) {
+void deleteFromBeginning(struct List* list) {
     // If list is empty, nothing to delete
-    if (*head == NULL) {
+    if (list->head == NULL) {
         printf("List is empty.\n");
         return;
     }
 
     // Temporary pointer to hold the node to delete
-    struct Node* temp = *head;
+    struct Node* temp = list->head;
 
     // Move head to the next node
-    *head = (*head)->next;
+    list->head = list->head->next;
+
+#if USE_VALUE_INDEX
+    indexRemove(&list->index, temp->data, temp);
+#endif
+    BLOOM_REMOVED();
 
     // Free memory of deleted node
+    STAT_FREE(sizeof(struct Node));
     free(temp);
 
     printf("Node deleted from beginning.\n");
 }
 
 // Function to delete a node from the end
-void deleteFromEnd(struct Node** head) {
-    if (*head == NULL) {
+void deleteFromEnd(struct List* list) {
+    if (list->head == NULL) {
         printf("List is empty.\n");
         return;
     }
 
-    struct Node* temp = *head;
+    struct Node* temp = list->head;
     struct Node* prev = NULL;
 
     // Traverse till the last node
     while (temp->next != NULL) {
+        STAT_VISIT();
         prev = temp;
         temp = temp->next;
     }
 
     // If there was only one node
     if (prev == NULL)
-        *head = NULL;
+        list->head = NULL;
     else
         prev->next = NULL; // Remove the last node
 
+#if USE_VALUE_INDEX
+    indexRemove(&list->index, temp->data, temp);
+#endif
+    BLOOM_REMOVED();
+
     // Free the deleted node memory
+    STAT_FREE(sizeof(struct Node));
     free(temp);
 
     printf("Node deleted from end.\n");
 }
 
 // Function to delete a node by its value
-void deleteByValue(struct Node** head, int value) {
-    struct Node* temp = *head;
+// Without the value index, the first node with the value goes.
+// With it (-DUSE_VALUE_INDEX=1) the node is found by a hash lookup
+// instead of a scan. A singly linked node cannot be unlinked without
+// its predecessor, so the next node's value is copied into it and
+// the next node is freed instead. Only the last node still needs a
+// scan. This is faster but not the same operation: if the value
+// occurs more than once, ANY one of the copies goes (5->3->5 may
+// become 5->3), and the node freed is not always the one that held
+// the value.
+void deleteByValue(struct List* list, int value) {
+    // A value the filter has never seen is not in the list
+    if (!BLOOM_MAY_CONTAIN(value)) {
+        printf("Value not found.\n");
+        return;
+    }
+
+#if USE_VALUE_INDEX
+    int bucket = indexLookup(&list->index, value, NULL);
+
+    // If value not found in the list
+    if (bucket == -1) {
+        BLOOM_FALSE_POSITIVE();
+        printf("Value not found.\n");
+        return;
+    }
+    BLOOM_REMOVED();
+
+    struct Node* target = list->index.entries[bucket].ref;
+    indexRemoveAt(&list->index, bucket);
+
+    if (target->next != NULL) {
+        // Pull the next node's data forward and drop the next node
+        struct Node* next = target->next;
+        int moved = indexLookup(&list->index, next->data, next);
+        list->index.entries[moved].ref = target;
+
+        target->data = next->data;
+        target->next = next->next;
+        STAT_FREE(sizeof(struct Node));
+        free(next);
+
+        printf("Node with value %d deleted.\n", value);
+        return;
+    }
+
+    // Target is the last node: find its predecessor
+    struct Node* temp = target;
+    struct Node* prev = NULL;
+    if (list->head != target) {
+        prev = list->head;
+        while (prev->next != target) {
+            STAT_VISIT();
+            prev = prev->next;
+        }
+    }
+#else
+    struct Node* temp = list->head;
     struct Node* prev = NULL;
 
     // Traverse until we find the value or reach end
-    while (temp != NULL && temp->data != value) {
+    while (temp != NULL && STAT_CMP(temp->data != value)) {
+        STAT_VISIT();
         prev = temp;
         temp = temp->next;
     }
 
     // If value not found in the list
     if (temp == NULL) {
+        BLOOM_FALSE_POSITIVE();
         printf("Value not found.\n");
         return;
     }
+    BLOOM_REMOVED();
+#endif
 
     // If node to delete is the first node
     if (prev == NULL)
-        *head = temp->next;
+        list->head = temp->next;
     else
         prev->next = temp->next;
 
+    STAT_FREE(sizeof(struct Node));
     free(temp);
     printf("Node with value %d deleted.\n", value);
 }
 
+/* ----------------------- SORTING -----------------------
+   Bottom-up merge sort on the node chain itself: first merge
+   runs of 1 node into sorted runs of 2, then runs of 2 into 4,
+   and so on. Only links change (no node is copied or allocated),
+   so it takes O(n log n) time and O(1) extra space, and the
+   value index stays valid.
+----------------------------------------------------------*/
+
+// Merges two sorted chains and returns the merged head.
+// The last node of the result is stored in *tail. Stable: on equal
+// values the node from 'a' comes first.
+struct Node* mergeRuns(struct Node* a, struct Node* b, struct Node** tail) {
+    struct Node dummy;          // Placeholder in front of the result
+    struct Node* last = &dummy;
+
+    while (a != NULL && b != NULL) {
+        STAT_VISIT();
+        if (STAT_CMP(b->data < a->data)) {
+            last->next = b;
+            b = b->next;
+        } else {
+            last->next = a;
+            a = a->next;
+        }
+        last = last->next;
+    }
+
+    // Attach whatever is left and find its end
+    last->next = (a != NULL) ? a : b;
+    while (last->next != NULL) {
+        STAT_VISIT();
+        last = last->next;
+    }
+
+    *tail = last;
+    return dummy.next;
+}
+
+// Function to merge two sorted lists into one sorted list in O(n + m)
+struct Node* mergeSortedLists(struct Node* a, struct Node* b) {
+    struct Node* tail;
+    return mergeRuns(a, b, &tail);
+}
+
+// Cuts the chain after 'n' nodes and returns the rest
+struct Node* splitAfter(struct Node* head, int n) {
+    int i;
+
+    for (i = 1; head != NULL && i < n; i++) {
+        STAT_VISIT();
+        head = head->next;
+    }
+
+    if (head == NULL)
+        return NULL;
+
+    struct Node* rest = head->next;
+    head->next = NULL;
+    return rest;
+}
+
+int countNodes(struct Node* head);
+
+// Function to sort the list in ascending order
+void sortList(struct Node** head) {
+    int n = countNodes(*head), width;
+    struct Node dummy;
+    dummy.next = *head;
+
+    for (width = 1; width < n; width *= 2) {
+        struct Node* tail = &dummy;
+        struct Node* rest = dummy.next;
+
+        // Merge each pair of neighbouring runs of 'width' nodes
+        while (rest != NULL) {
+            struct Node* left = rest;
+            struct Node* right = splitAfter(left, width);
+            rest = splitAfter(right, width);
+            tail->next = mergeRuns(left, right, &tail);
+        }
+    }
+
+    *head = dummy.next;
+}
+
+// Function to insert a value into a sorted list, keeping it sorted
+void sortedInsert(struct List* list, int value) {
+    struct Node* newNode = createNode(value);
+    struct Node** link = &list->head;
+
+    // Find the first node with a larger value (after any equal ones)
+    while (*link != NULL && STAT_CMP((*link)->data <= value)) {
+        STAT_VISIT();
+        link = &(*link)->next;
+    }
+
+    newNode->next = *link;
+    *link = newNode;
+
+#if USE_VALUE_INDEX
+    indexInsert(&list->index, value, newNode);
+#endif
+
+    printf("Node inserted in sorted position.\n");
+}
+
+// Reads 'n' values into a new sorted chain. The chain is about to be
+// merged into 'list', so its nodes go into that list's index.
+struct Node* readSortedList(struct List* list, int n) {
+    struct Node* head = NULL;
+    int i, value;
+
+#if !USE_VALUE_INDEX
+    (void)list;  // Only its index is needed here
+#endif
+
+    printf("Enter %d values: ", n);
+    for (i = 0; i < n; i++) {
+        scanf("%d", &value);
+        struct Node* newNode = createNode(value);
+        newNode->next = head;
+        head = newNode;
+#if USE_VALUE_INDEX
+        indexInsert(&list->index, value, newNode);
+#endif
+    }
+
+    sortList(&head);
+    return head;
+}
+
+// Refills the Bloom filter from the list once deletes have left too
+// many stale bits in it (deleted values cannot be cleared)
+void refreshBloom(struct Node* head) {
+    if (!BLOOM_NEEDS_REBUILD())
+        return;
+
+    BLOOM_REBUILD();
+    while (head != NULL) {
+        BLOOM_ADD(head->data);
+        head = head->next;
+    }
+}
+
 // Function to display all nodes in the linked list
 void displayList(struct Node* head) {
     if (head == NULL) {
@@ -170,11 +444,13 @@ void displayList(struct Node* head) {
 
     // Traverse through the list and print data
     while (temp != NULL) {
-        printf("%d -> ", temp->data);
+        STAT_VISIT();
+        OUT_INT(temp->data, " -> ");
         temp = temp->next;
     }
 
-    printf("NULL\n");
+    OUT_TEXT("NULL\n");
+    OUT_FLUSH();
 }
 
 // Function to count the number of nodes
@@ -184,6 +460,7 @@ int countNodes(struct Node* head) {
 
     // Traverse the list and increase count for each node
     while (temp != NULL) {
+        STAT_VISIT();
         count++;
         temp = temp->next;
     }
@@ -193,10 +470,14 @@ int countNodes(struct Node* head) {
 
 // Main function to test all operations
 int main() {
-    struct Node* head = NULL;  // Initially, the list is empty
-    int choice, value, position;
+    struct List list;  // Initially, the list is empty
+    int choice, value, position, n;
+
+    createList(&list);
 
     while (1) {
+        refreshBloom(list.head);
+
         printf("\n--- SINGLE LINKED LIST OPERATIONS ---\n");
         printf("1. Insert at Beginning\n");
         printf("2. Insert at End\n");
@@ -206,6 +487,9 @@ int main() {
         printf("6. Delete by Value\n");
         printf("7. Display List\n");
         printf("8. Count Nodes\n");
+        printf("10. Sort List\n");
+        printf("11. Sorted Insert\n");
+        printf("12. Merge with Another Sorted List\n");
         printf("9. Exit\n");
         printf("Enter your choice: ");
         scanf("%d", &choice);
@@ -214,13 +498,13 @@ int main() {
             case 1:
                 printf("Enter value to insert: ");
                 scanf("%d", &value);
-                insertAtBeginning(&head, value);
+                insertAtBeginning(&list, value);
                 break;
 
             case 2:
                 printf("Enter value to insert: ");
                 scanf("%d", &value);
-                insertAtEnd(&head, value);
+                insertAtEnd(&list, value);
                 break;
 
             case 3:
@@ -228,35 +512,59 @@ int main() {
                 scanf("%d", &position);
                 printf("Enter value to insert: ");
                 scanf("%d", &value);
-                insertAfterPosition(head, position, value);
+                insertAfterPosition(&list, position, value);
                 break;
 
             case 4:
-                deleteFromBeginning(&head);
+                deleteFromBeginning(&list);
                 break;
 
             case 5:
-                deleteFromEnd(&head);
+                deleteFromEnd(&list);
                 break;
 
             case 6:
                 printf("Enter value to delete: ");
                 scanf("%d", &value);
-                deleteByValue(&head, value);
+                deleteByValue(&list, value);
                 break;
 
             case 7:
-                displayList(head);
+                displayList(list.head);
                 break;
 
             case 8:
-                printf("Total nodes: %d\n", countNodes(head));
+                printf("Total nodes: %d\n", countNodes(list.head));
                 break;
 
             case 9:
                 printf("Exiting program...\n");
+                STATS_DUMP();
+                BLOOM_REPORT();
                 exit(0);
 
+            // Added later, so they take new numbers and the
+            // original choices (and scripted input) keep working
+            case 10:
+                sortList(&list.head);
+                printf("List sorted.\n");
+                break;
+
+            case 11:
+                printf("Enter value to insert: ");
+                scanf("%d", &value);
+                sortedInsert(&list, value);
+                break;
+
+            case 12:
+                printf("Enter number of values in the other list: ");
+                scanf("%d", &n);
+                // Both inputs of a merge must be sorted
+                sortList(&list.head);
+                list.head = mergeSortedLists(list.head, readSortedList(&list, n));
+                printf("Lists merged.\n");
+                break;
+
             default:
                 printf("Invalid choice! Try again.\n");
         }
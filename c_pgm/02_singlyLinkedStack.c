@@ -1,5 +1,7 @@
 #include <stdio.h>
 #include <stdlib.h>
+#include "instrument.h"
+#include "fastout.h"
 
 // Structure for a stack node
 // Each node contains a 'data' part and a 'next' pointer
@@ -9,10 +11,13 @@ struct Node {
     struct Node* next;     // Pointer to the next node (node below the current one)
 };
 
+STATS_DEFINE("linked_stack");
+
 // Function to PUSH (insert) an element onto the stack
 void push(struct Node** top, int value) {
     // Step 1: Create a new node dynamically
     struct Node* newNode = (struct Node*)malloc(sizeof(struct Node));
+    STAT_ALLOC(sizeof(struct Node));
 
     // Step 2: Assign the data value to the new node
     newNode->data = value;
@@ -46,6 +51,7 @@ void pop(struct Node** top) {
     *top = (*top)->next;
 
     // Step 5: Free the memory of the popped node
+    STAT_FREE(sizeof(struct Node));
     free(temp);
 }
 
@@ -63,11 +69,13 @@ void display(struct Node* top) {
 
     // Step 3: Traverse until we reach the end of the stack (NULL)
     while (temp != NULL) {
-        printf("%d ", temp->data);  // Print current node’s data
+        STAT_VISIT();
+        OUT_INT(temp->data, " ");  // Print current node’s data
         temp = temp->next;          // Move to the next node
     }
 
-    printf("\n");  // Move to next line after printing all elements
+    OUT_TEXT("\n");  // Move to next line after printing all elements
+    OUT_FLUSH();
 }
 
 // Function to COUNT how many elements are in the stack
@@ -77,6 +85,7 @@ int count(struct Node* top) {
 
     // Traverse the stack and increment count for each node
     while (temp != NULL) {
+        STAT_VISIT();
         count++;
         temp = temp->next;
     }
@@ -123,6 +132,7 @@ int main() {
 
             case 5:
                 printf("Exiting program...\n");
+                STATS_DUMP();
                 exit(0);              // Terminate program
                 break;
 
@@ -1,5 +1,12 @@
 #include <stdio.h>
 #include <stdlib.h>
+#include "instrument.h"
+#include "fastout.h"
+
+// Set to 0 to drop the value index and find values by a linear scan
+#ifndef USE_VALUE_INDEX
+#define USE_VALUE_INDEX 1
+#endif
 
 // Structure for a doubly linked list node
 // Each node has three parts:
@@ -12,10 +19,38 @@ struct Node {
     struct Node* next;
 };
 
+STATS_DEFINE("doubly_linked_list");
+
+#if USE_VALUE_INDEX
+#include "valueindex.h"
+#endif
+
+// List handle: keeps both ends and the length, so operations on
+// either end never have to walk the list
+struct List {
+    struct Node* head;  // First node
+    struct Node* tail;  // Last node
+    int size;           // Number of nodes
+#if USE_VALUE_INDEX
+    struct ValueIndex index;  // value -> node, kept in sync with the list
+#endif
+};
+
+// Function to initialize an empty list
+void createList(struct List* list) {
+    list->head = NULL;
+    list->tail = NULL;
+    list->size = 0;
+#if USE_VALUE_INDEX
+    initIndex(&list->index, 16);
+#endif
+}
+
 // Function to create a new node with a given value
 struct Node* createNode(int value) {
     // Dynamically allocate memory for a new node
     struct Node* newNode = (struct Node*)malloc(sizeof(struct Node));
+    STAT_ALLOC(sizeof(struct Node));
 
     // Assign data and initialize pointers to NULL
     newNode->data = value;
@@ -27,168 +62,410 @@ struct Node* createNode(int value) {
 }
 
 // Function to insert a node at the beginning of the list
-void insertAtBeginning(struct Node** head, int value) {
+void insertAtBeginning(struct List* list, int value) {
     // Create a new node
     struct Node* newNode = createNode(value);
 
-    // If list is empty, new node becomes the head
-    if (*head == NULL) {
-        *head = newNode;
+    // If list is empty, new node is both head and tail
+    if (list->head == NULL) {
+        list->head = newNode;
+        list->tail = newNode;
     } else {
         // Link the new node with the existing head
-        newNode->next = *head;
+        newNode->next = list->head;
 
         // Update the previous pointer of the current head
-        (*head)->prev = newNode;
+        list->head->prev = newNode;
 
         // Move head pointer to the new node
-        *head = newNode;
+        list->head = newNode;
     }
+    list->size++;
+
+#if USE_VALUE_INDEX
+    indexInsert(&list->index, value, newNode);
+#endif
 
     printf("Node inserted at beginning.\n");
 }
 
 // Function to insert a node at the end of the list
-void insertAtEnd(struct Node** head, int value) {
+void insertAtEnd(struct List* list, int value) {
     // Create a new node
     struct Node* newNode = createNode(value);
 
-    // If list is empty, new node becomes the head
-    if (*head == NULL) {
-        *head = newNode;
+    // If list is empty, new node is both head and tail
+    if (list->tail == NULL) {
+        list->head = newNode;
+        list->tail = newNode;
     } else {
-        // Traverse to the last node
-        struct Node* temp = *head;
-        while (temp->next != NULL)
-            temp = temp->next;
+        // Link last node to the new node (no traversal needed)
+        list->tail->next = newNode;
+        newNode->prev = list->tail;  // Link back to the previous node
 
-        // Link last node to the new node
-        temp->next = newNode;
-        newNode->prev = temp;  // Link back to the previous node
+        // Move tail pointer to the new node
+        list->tail = newNode;
     }
+    list->size++;
+
+#if USE_VALUE_INDEX
+    indexInsert(&list->index, value, newNode);
+#endif
 
     printf("Node inserted at end.\n");
 }
 
+// Takes a node out of the list, fixing head/tail when needed
+void unlinkNode(struct List* list, struct Node* node) {
+    if (node->prev != NULL)
+        node->prev->next = node->next;
+    else
+        list->head = node->next;  // Node was the head
+
+    if (node->next != NULL)
+        node->next->prev = node->prev;
+    else
+        list->tail = node->prev;  // Node was the tail
+
+    list->size--;
+}
+
 // Function to delete a node from the beginning
-void deleteFromBeginning(struct Node** head) {
+void deleteFromBeginning(struct List* list) {
     // Check if list is empty
-    if (*head == NULL) {
+    if (list->head == NULL) {
         printf("List is empty. Cannot delete.\n");
         return;
     }
 
     // Temporary pointer to the node being deleted
-    struct Node* temp = *head;
-
-    // Move head pointer to the next node
-    *head = (*head)->next;
-
-    // If list is not empty after deletion, set prev of new head to NULL
-    if (*head != NULL)
-        (*head)->prev = NULL;
+    struct Node* temp = list->head;
+    unlinkNode(list, temp);
 
     printf("Node with value %d deleted from beginning.\n", temp->data);
 
+#if USE_VALUE_INDEX
+    indexRemove(&list->index, temp->data, temp);
+#endif
+
     // Free the memory of deleted node
+    STAT_FREE(sizeof(struct Node));
     free(temp);
 }
 
 // Function to delete a node from the end
-void deleteFromEnd(struct Node** head) {
+void deleteFromEnd(struct List* list) {
     // If list is empty
-    if (*head == NULL) {
+    if (list->tail == NULL) {
         printf("List is empty. Cannot delete.\n");
         return;
     }
 
-    struct Node* temp = *head;
+    // The last node is known directly
+    struct Node* temp = list->tail;
+    unlinkNode(list, temp);
+
+    printf("Node with value %d deleted from end.\n", temp->data);
+
+#if USE_VALUE_INDEX
+    indexRemove(&list->index, temp->data, temp);
+#endif
+
+    // Free the deleted node
+    STAT_FREE(sizeof(struct Node));
+    free(temp);
+}
 
-    // Traverse to the last node
-    while (temp->next != NULL)
+// Finds the first node holding 'value', or NULL
+struct Node* findFirst(struct List* list, int value) {
+    struct Node* temp = list->head;
+
+    // Traverse until we find the value or reach end
+    while (temp != NULL && STAT_CMP(temp->data != value)) {
+        STAT_VISIT();
         temp = temp->next;
+    }
+    return temp;
+}
 
-    // If there is only one node
-    if (temp->prev == NULL) {
-        *head = NULL;
-    } else {
-        // Remove the link from the previous node
-        temp->prev->next = NULL;
+// Function to delete the first node with a given value
+// With the value index a value that occurs once is found by a hash
+// lookup, and the 'prev' link lets it be unlinked without any scan:
+// O(1) expected. The index does not know the list order, so if the
+// value occurs more than once the list is still scanned for the
+// first copy, as it is without the index.
+void deleteByValue(struct List* list, int value) {
+    struct Node* temp;
+
+#if USE_VALUE_INDEX
+    int bucket = indexLookup(&list->index, value, NULL);
+    if (bucket == -1)
+        temp = NULL;
+    else if (indexNext(&list->index, value, bucket) == -1)
+        temp = list->index.entries[bucket].ref;
+    else {
+        temp = findFirst(list, value);
+        bucket = indexLookup(&list->index, value, temp);
     }
+#else
+    temp = findFirst(list, value);
+#endif
 
-    printf("Node with value %d deleted from end.\n", temp->data);
+    // If value not found in the list
+    if (temp == NULL) {
+        printf("Value not found.\n");
+        return;
+    }
 
-    // Free the deleted node
+#if USE_VALUE_INDEX
+    indexRemoveAt(&list->index, bucket);
+#endif
+
+    // Bypass the node from both sides
+    unlinkNode(list, temp);
+
+    STAT_FREE(sizeof(struct Node));
     free(temp);
+    printf("Node with value %d deleted.\n", value);
+}
+
+/* ----------------------- SORTING -----------------------
+   Bottom-up merge sort on the node chain itself: merge runs of
+   1 node into runs of 2, then 4, and so on. Only links change,
+   so it takes O(n log n) time and O(1) extra space. 'prev' links
+   are set while merging, in the same pass as 'next'.
+----------------------------------------------------------*/
+
+// Merges two sorted chains behind 'last' and returns the new last
+// node. Stable: on equal values the node from 'a' comes first.
+struct Node* mergeRuns(struct Node* last, struct Node* a, struct Node* b) {
+    while (a != NULL && b != NULL) {
+        STAT_VISIT();
+        struct Node** smaller = STAT_CMP(b->data < a->data) ? &b : &a;
+        last->next = *smaller;
+        (*smaller)->prev = last;
+        last = *smaller;
+        *smaller = (*smaller)->next;
+    }
+
+    // Attach whatever is left, fixing 'prev' up to its end
+    for (last->next = (a != NULL) ? a : b; last->next != NULL; last = last->next) {
+        STAT_VISIT();
+        last->next->prev = last;
+    }
+
+    return last;
+}
+
+// Cuts the chain after 'n' nodes and returns the rest
+struct Node* splitAfter(struct Node* head, int n) {
+    int i;
+
+    for (i = 1; head != NULL && i < n; i++) {
+        STAT_VISIT();
+        head = head->next;
+    }
+
+    if (head == NULL)
+        return NULL;
+
+    struct Node* rest = head->next;
+    head->next = NULL;
+    return rest;
+}
+
+// Function to sort the list in ascending order
+void sortList(struct List* list) {
+    struct Node dummy;   // Placeholder in front of the first node
+    struct Node* tail = NULL;
+    int width;
+
+    if (list->size < 2)
+        return;
+
+    dummy.next = list->head;
+
+    for (width = 1; width < list->size; width *= 2) {
+        struct Node* rest = dummy.next;
+        tail = &dummy;
+
+        // Merge each pair of neighbouring runs of 'width' nodes
+        while (rest != NULL) {
+            struct Node* left = rest;
+            struct Node* right = splitAfter(left, width);
+            rest = splitAfter(right, width);
+            tail = mergeRuns(tail, left, right);
+        }
+    }
+
+    list->head = dummy.next;
+    list->head->prev = NULL;
+    list->tail = tail;
+}
+
+// Function to merge the sorted list 'other' into the sorted 'list'
+// in O(n + m). 'other' is left empty.
+void mergeSortedLists(struct List* list, struct List* other) {
+    struct Node dummy;
+
+    if (other->head == NULL)
+        return;
+
+#if USE_VALUE_INDEX
+    // Hand the other list's index entries over
+    int i;
+    for (i = 0; i < other->index.capacity; i++)
+        if (other->index.entries[i].ref != NULL)
+            indexInsert(&list->index, other->index.entries[i].value, other->index.entries[i].ref);
+    freeIndex(&other->index);
+    initIndex(&other->index, 16);
+#endif
+
+    list->tail = mergeRuns(&dummy, list->head, other->head);
+    list->head = dummy.next;
+    list->head->prev = NULL;
+    list->size += other->size;
+
+    other->head = other->tail = NULL;
+    other->size = 0;
+}
+
+// Function to insert a value into a sorted list, keeping it sorted
+void sortedInsert(struct List* list, int value) {
+    struct Node* temp = list->head;
+
+    // Find the first node with a larger value (after any equal ones)
+    while (temp != NULL && STAT_CMP(temp->data <= value)) {
+        STAT_VISIT();
+        temp = temp->next;
+    }
+
+    if (temp == NULL) {
+        insertAtEnd(list, value);  // Largest value so far
+        return;
+    }
+    if (temp == list->head) {
+        insertAtBeginning(list, value);  // Smallest value so far
+        return;
+    }
+
+    // Link the new node in before 'temp'
+    struct Node* newNode = createNode(value);
+    newNode->prev = temp->prev;
+    newNode->next = temp;
+    temp->prev->next = newNode;
+    temp->prev = newNode;
+    list->size++;
+
+#if USE_VALUE_INDEX
+    indexInsert(&list->index, value, newNode);
+#endif
+
+    printf("Node inserted in sorted position.\n");
 }
 
 // Function to traverse and display the list from beginning to end
-void traverseFromBeginning(struct Node* head) {
-    if (head == NULL) {
+void traverseFromBeginning(struct List* list) {
+    if (list->head == NULL) {
         printf("List is empty.\n");
         return;
     }
 
     printf("Traversal from beginning: ");
-    struct Node* temp = head;
+    struct Node* temp = list->head;
 
     // Move forward until end of list
     while (temp != NULL) {
-        printf("%d ", temp->data);
+        STAT_VISIT();
+        OUT_INT(temp->data, " ");
         temp = temp->next;
     }
 
-    printf("\n");
+    OUT_TEXT("\n");
+    OUT_FLUSH();
 }
 
 // Function to traverse and display the list from end to beginning
-void traverseFromEnd(struct Node* head) {
-    if (head == NULL) {
+void traverseFromEnd(struct List* list) {
+    if (list->tail == NULL) {
         printf("List is empty.\n");
         return;
     }
 
-    struct Node* temp = head;
-
-    // Move to the last node
-    while (temp->next != NULL)
-        temp = temp->next;
-
     printf("Traversal from end: ");
 
-    // Move backward using 'prev' pointers
+    // Start at the tail and move backward using 'prev' pointers
+    struct Node* temp = list->tail;
     while (temp != NULL) {
-        printf("%d ", temp->data);
+        STAT_VISIT();
+        OUT_INT(temp->data, " ");
         temp = temp->prev;
     }
 
-    printf("\n");
+    OUT_TEXT("\n");
+    OUT_FLUSH();
 }
 
 // Function to display both traversals
-void displayBothSides(struct Node* head) {
-    traverseFromBeginning(head);
-    traverseFromEnd(head);
+void displayBothSides(struct List* list) {
+    traverseFromBeginning(list);
+    traverseFromEnd(list);
 }
 
 // Function to count how many nodes are in the list
-int countNodes(struct Node* head) {
-    int count = 0;
-    struct Node* temp = head;
+// The handle keeps the count, so this is O(1)
+int countNodes(struct List* list) {
+    return list->size;
+}
+
+// Function to free every node and the index
+void destroyList(struct List* list) {
+    struct Node* temp = list->head;
 
-    // Traverse through the list and count each node
     while (temp != NULL) {
-        count++;
-        temp = temp->next;
+        struct Node* next = temp->next;
+        STAT_FREE(sizeof(struct Node));
+        free(temp);
+        temp = next;
+    }
+
+    list->head = list->tail = NULL;
+    list->size = 0;
+#if USE_VALUE_INDEX
+    freeIndex(&list->index);
+#endif
+}
+
+// Reads 'n' values into 'list' (which must be empty) and sorts it
+void readSortedList(struct List* list, int n) {
+    int i, value;
+
+    printf("Enter %d values: ", n);
+    for (i = 0; i < n; i++) {
+        scanf("%d", &value);
+        struct Node* newNode = createNode(value);
+        newNode->next = list->head;
+        if (list->head != NULL)
+            list->head->prev = newNode;
+        else
+            list->tail = newNode;
+        list->head = newNode;
+        list->size++;
+#if USE_VALUE_INDEX
+        indexInsert(&list->index, value, newNode);
+#endif
     }
 
-    return count;
+    sortList(list);
 }
 
 // MAIN FUNCTION — Menu-driven program
 int main() {
-    struct Node* head = NULL;  // Initially, list is empty
-    int choice, value;
+    struct List list;  // Initially, list is empty
+    struct List other; // Second list for merging
+    int choice, value, n;
+
+    createList(&list);
 
     while (1) {
         printf("\n--- DOUBLY LINKED LIST OPERATIONS ---\n");
@@ -200,6 +477,10 @@ int main() {
         printf("6. Traverse from End\n");
         printf("7. Display from Both Sides\n");
         printf("8. Count Number of Nodes\n");
+        printf("10. Delete by Value\n");
+        printf("11. Sort List\n");
+        printf("12. Sorted Insert\n");
+        printf("13. Merge with Another Sorted List\n");
         printf("9. Exit\n");
         printf("Enter your choice: ");
         scanf("%d", &choice);
@@ -208,43 +489,76 @@ int main() {
             case 1:
                 printf("Enter value to insert: ");
                 scanf("%d", &value);
-                insertAtBeginning(&head, value);
+                insertAtBeginning(&list, value);
                 break;
 
             case 2:
                 printf("Enter value to insert: ");
                 scanf("%d", &value);
-                insertAtEnd(&head, value);
+                insertAtEnd(&list, value);
                 break;
 
             case 3:
-                deleteFromBeginning(&head);
+                deleteFromBeginning(&list);
                 break;
 
             case 4:
-                deleteFromEnd(&head);
+                deleteFromEnd(&list);
                 break;
 
             case 5:
-                traverseFromBeginning(head);
+                traverseFromBeginning(&list);
                 break;
 
             case 6:
-                traverseFromEnd(head);
+                traverseFromEnd(&list);
                 break;
 
             case 7:
-                displayBothSides(head);
+                displayBothSides(&list);
                 break;
 
             case 8:
-                printf("Total number of nodes: %d\n", countNodes(head));
+                printf("Total number of nodes: %d\n", countNodes(&list));
                 break;
 
             case 9:
                 printf("Exiting program...\n");
+                STATS_DUMP();
+                destroyList(&list);
                 exit(0);
 
+            // Added later, so they take new numbers and the
+            // original choices (and scripted input) keep working
+            case 10:
+                printf("Enter value to delete: ");
+                scanf("%d", &value);
+                deleteByValue(&list, value);
+                break;
+
+            case 11:
+                sortList(&list);
+                printf("List sorted.\n");
+                break;
+
+            case 12:
+                printf("Enter value to insert: ");
+                scanf("%d", &value);
+                sortedInsert(&list, value);
+                break;
+
+            case 13:
+                printf("Enter number of values in the other list: ");
+                scanf("%d", &n);
+                createList(&other);
+                readSortedList(&other, n);
+                // Both inputs of a merge must be sorted
+                sortList(&list);
+                mergeSortedLists(&list, &other);
+                destroyList(&other);
+                printf("Lists merged.\n");
+                break;
+
             default:
                 printf("Invalid choice! Please try again.\n");
         }
@@ -1,5 +1,7 @@
 #include <stdio.h>
 #include <stdlib.h>
+#include "instrument.h"
+#include "fastout.h"
 
 #define SIZE 5  // Maximum size of the circular queue
 
@@ -10,6 +12,8 @@ struct CircularQueue {
     int rear;         // Points to the rear (last) element
 };
 
+STATS_DEFINE("circular_queue");
+
 // Function to initialize the queue (Creation)
 void createQueue(struct CircularQueue *q) {
     // Initially, both front and rear are set to -1 (queue is empty)
@@ -39,6 +43,7 @@ int isEmpty(struct CircularQueue *q) {
 void enqueue(struct CircularQueue *q, int value) {
     // If queue is full, no insertion possible
     if (isFull(q)) {
+        STAT_QUEUE_FULL();
         printf("Queue Overflow! Cannot insert %d\n", value);
         return;
     }
@@ -61,6 +66,7 @@ void enqueue(struct CircularQueue *q, int value) {
 void dequeue(struct CircularQueue *q) {
     // If queue is empty, no deletion possible
     if (isEmpty(q)) {
+        STAT_QUEUE_EMPTY();
         printf("Queue Underflow! Cannot delete.\n");
         return;
     }
@@ -92,12 +98,14 @@ void display(struct CircularQueue *q) {
 
     // Loop until we reach the rear element
     while (1) {
-        printf("%d ", q->items[i]);
+        STAT_VISIT();
+        OUT_INT(q->items[i], " ");
         if (i == q->rear)
             break;  // Stop when we reach the rear
         i = (i + 1) % SIZE;  // Move circularly
     }
-    printf("\n");
+    OUT_TEXT("\n");
+    OUT_FLUSH();
 }
 
 // Function to count total elements in the queue
@@ -153,6 +161,7 @@ int main() {
 
             case 5:
                 printf("Exiting program...\n");
+                STATS_DUMP();
                 exit(0);  // Exit the program
 
             default:
@@ -1,5 +1,7 @@
 #include <stdio.h>
 #include <stdlib.h>
+#include "instrument.h"
+#include "fastout.h"
 
 // Structure definition for a node in the binary tree
 struct Node {
@@ -8,10 +10,13 @@ struct Node {
     struct Node* right;     // Pointer to the right child
 };
 
+STATS_DEFINE("binary_tree");
+
 // Function to create a new node with given value
 struct Node* createNode(int value) {
     // Dynamically allocate memory for a new node
     struct Node* newNode = (struct Node*)malloc(sizeof(struct Node));
+    STAT_ALLOC(sizeof(struct Node));
     newNode->data = value;   // Assign the given value to the node
     newNode->left = NULL;    // Initialize left child as NULL
     newNode->right = NULL;   // Initialize right child as NULL
@@ -36,6 +41,7 @@ struct Node* insertNode(struct Node* root, int value) {
 
     // Perform level-order traversal until an empty position is found
     while (front < rear) {
+        STAT_VISIT();
         struct Node* temp = queue[front++];  // Dequeue node
 
         // Check if left child is empty → insert there
@@ -72,6 +78,7 @@ struct Node* findDeepestNode(struct Node* root) {
 
     // Level order traversal till the last node
     while (front < rear) {
+        STAT_VISIT();
         temp = queue[front++];
         if (temp->left)
             queue[rear++] = temp->left;
@@ -103,9 +110,10 @@ struct Node* deleteNode(struct Node* root, int value) {
 
     // Step 1: Find node to delete (keyNode) and the last node
     while (front < rear) {
+        STAT_VISIT();
         temp = queue[front++];
 
-        if (temp->data == value)
+        if (STAT_CMP(temp->data == value))
             keyNode = temp;  // Found node to delete
 
         if (temp->left)
@@ -124,11 +132,13 @@ struct Node* deleteNode(struct Node* root, int value) {
         front = rear = 0;
         queue[rear++] = root;
         while (front < rear) {
+            STAT_VISIT();
             temp = queue[front++];
 
             // Check left child
             if (temp->left) {
                 if (temp->left == deepest) {
+                    STAT_FREE(sizeof(struct Node));
                     free(temp->left);      // Free memory
                     temp->left = NULL;     // Remove link
                     break;
@@ -139,6 +149,7 @@ struct Node* deleteNode(struct Node* root, int value) {
             // Check right child
             if (temp->right) {
                 if (temp->right == deepest) {
+                    STAT_FREE(sizeof(struct Node));
                     free(temp->right);
                     temp->right = NULL;
                     break;
@@ -160,7 +171,8 @@ void inorder(struct Node* root) {
     if (root == NULL)
         return;
     inorder(root->left);            // Visit left subtree
-    printf("%d ", root->data);      // Visit root
+    STAT_VISIT();
+    OUT_INT(root->data, " ");      // Visit root
     inorder(root->right);           // Visit right subtree
 }
 
@@ -168,7 +180,8 @@ void inorder(struct Node* root) {
 void preorder(struct Node* root) {
     if (root == NULL)
         return;
-    printf("%d ", root->data);      // Visit root
+    STAT_VISIT();
+    OUT_INT(root->data, " ");      // Visit root
     preorder(root->left);           // Visit left subtree
     preorder(root->right);          // Visit right subtree
 }
@@ -179,7 +192,142 @@ void postorder(struct Node* root) {
         return;
     postorder(root->left);          // Visit left subtree
     postorder(root->right);         // Visit right subtree
-    printf("%d ", root->data);      // Visit root last
+    STAT_VISIT();
+    OUT_INT(root->data, " ");      // Visit root last
+}
+
+/* --------------- MORRIS TRAVERSALS ----------------------
+   Walk the tree without recursion, a stack or a queue.
+   Before going into a left subtree, the rightmost node of that
+   subtree (the inorder predecessor) gets a temporary right link
+   ("thread") back to the current node. The thread is followed
+   to climb back up and is removed on the second visit, so the
+   tree is unchanged when the walk ends.
+   Extra space: O(1). Time: O(n) (each edge is walked at most 3 times).
+----------------------------------------------------------*/
+
+// Morris Inorder Traversal: Left → Root → Right
+void morrisInorder(struct Node* root) {
+    struct Node* curr = root;
+
+    while (curr != NULL) {
+        if (curr->left == NULL) {
+            STAT_VISIT();
+            OUT_INT(curr->data, " ");   // No left subtree → visit
+            curr = curr->right;          // Go right (may follow a thread)
+        } else {
+            // Find the inorder predecessor of curr
+            struct Node* pred = curr->left;
+            while (pred->right != NULL && pred->right != curr) {
+                STAT_VISIT();
+                pred = pred->right;
+            }
+
+            if (pred->right == NULL) {
+                pred->right = curr;      // First visit: make the thread
+                curr = curr->left;
+            } else {
+                pred->right = NULL;      // Second visit: remove the thread
+                STAT_VISIT();
+                OUT_INT(curr->data, " ");
+                curr = curr->right;
+            }
+        }
+    }
+}
+
+// Morris Preorder Traversal: Root → Left → Right
+void morrisPreorder(struct Node* root) {
+    struct Node* curr = root;
+
+    while (curr != NULL) {
+        if (curr->left == NULL) {
+            STAT_VISIT();
+            OUT_INT(curr->data, " ");
+            curr = curr->right;
+        } else {
+            struct Node* pred = curr->left;
+            while (pred->right != NULL && pred->right != curr) {
+                STAT_VISIT();
+                pred = pred->right;
+            }
+
+            if (pred->right == NULL) {
+                STAT_VISIT();
+                OUT_INT(curr->data, " ");  // Visit before going left
+                pred->right = curr;
+                curr = curr->left;
+            } else {
+                pred->right = NULL;
+                curr = curr->right;
+            }
+        }
+    }
+}
+
+// Reverses the chain of right pointers from 'from' to 'to'
+void reverseRightChain(struct Node* from, struct Node* to) {
+    if (from == to)
+        return;
+
+    struct Node* prev = from;
+    struct Node* curr = from->right;
+    while (prev != to) {
+        struct Node* next = curr->right;
+        curr->right = prev;
+        prev = curr;
+        curr = next;
+    }
+}
+
+// Prints the right chain from 'from' to 'to' in reverse order,
+// by reversing it in place, printing and reversing it back
+void printRightChainReversed(struct Node* from, struct Node* to) {
+    reverseRightChain(from, to);
+
+    struct Node* p = to;
+    while (1) {
+        STAT_VISIT();
+        OUT_INT(p->data, " ");
+        if (p == from)
+            break;
+        p = p->right;
+    }
+
+    reverseRightChain(to, from);
+}
+
+// Morris Postorder Traversal: Left → Right → Root
+// A dummy node with the whole tree as its left child makes the
+// root's right spine get printed like any other left subtree.
+void morrisPostorder(struct Node* root) {
+    struct Node dummy;
+    dummy.left = root;
+    dummy.right = NULL;
+
+    struct Node* curr = &dummy;
+
+    while (curr != NULL) {
+        if (curr->left == NULL) {
+            curr = curr->right;
+        } else {
+            struct Node* pred = curr->left;
+            while (pred->right != NULL && pred->right != curr) {
+                STAT_VISIT();
+                pred = pred->right;
+            }
+
+            if (pred->right == NULL) {
+                pred->right = curr;
+                curr = curr->left;
+            } else {
+                // Left subtree finished: print its right edge bottom-up
+                printRightChainReversed(curr->left, pred);
+                pred->right = NULL;
+                curr = curr->right;
+            }
+        }
+    }
 }
 
 /* ------------------- COUNT NODES ------------------------
@@ -188,10 +336,22 @@ void postorder(struct Node* root) {
 int countNodes(struct Node* root) {
     if (root == NULL)
         return 0;
+    STAT_VISIT();
     // Count = 1 (current node) + left subtree + right subtree
     return 1 + countNodes(root->left) + countNodes(root->right);
 }
 
+/* ------------------- TREE HEIGHT ------------------------
+   Number of levels: 0 for an empty tree, 1 for a single node
+----------------------------------------------------------*/
+int treeHeight(struct Node* root) {
+    if (root == NULL)
+        return 0;
+    int left = treeHeight(root->left);
+    int right = treeHeight(root->right);
+    return 1 + (left > right ? left : right);
+}
+
 /* -------------------- MAIN FUNCTION ---------------------
    Menu-driven program to test all operations on Binary Tree
 -----------------------------------------------------------*/
@@ -207,6 +367,9 @@ int main() {
         printf("4. Preorder Traversal\n");
         printf("5. Postorder Traversal\n");
         printf("6. Count Nodes\n");
+        printf("8. Morris Inorder Traversal (no stack)\n");
+        printf("9. Morris Preorder Traversal (no stack)\n");
+        printf("10. Morris Postorder Traversal (no stack)\n");
         printf("7. Exit\n");
         printf("Enter your choice: ");
         scanf("%d", &choice);
@@ -227,19 +390,22 @@ int main() {
             case 3:
                 printf("Inorder Traversal: ");
                 inorder(root);
-                printf("\n");
+                OUT_TEXT("\n");
+                OUT_FLUSH();
                 break;
 
             case 4:
                 printf("Preorder Traversal: ");
                 preorder(root);
-                printf("\n");
+                OUT_TEXT("\n");
+                OUT_FLUSH();
                 break;
 
             case 5:
                 printf("Postorder Traversal: ");
                 postorder(root);
-                printf("\n");
+                OUT_TEXT("\n");
+                OUT_FLUSH();
                 break;
 
             case 6:
@@ -248,8 +414,33 @@ int main() {
 
             case 7:
                 printf("Exiting program...\n");
+                STAT_HEIGHT(treeHeight(root));
+                STATS_DUMP();
                 exit(0);
 
+            // Added later, so they take new numbers and the
+            // original choices (and scripted input) keep working
+            case 8:
+                printf("Morris Inorder Traversal: ");
+                morrisInorder(root);
+                OUT_TEXT("\n");
+                OUT_FLUSH();
+                break;
+
+            case 9:
+                printf("Morris Preorder Traversal: ");
+                morrisPreorder(root);
+                OUT_TEXT("\n");
+                OUT_FLUSH();
+                break;
+
+            case 10:
+                printf("Morris Postorder Traversal: ");
+                morrisPostorder(root);
+                OUT_TEXT("\n");
+                OUT_FLUSH();
+                break;
+
             default:
                 printf("Invalid choice! Try again.\n");
         }
@@ -1,5 +1,8 @@
 #include <stdio.h>
 #include <stdlib.h>
+#include "instrument.h"
+#include "fastout.h"
+#include "bloom.h"
 
 /////////////////////////////////////
 // STRUCTURE OF A BST NODE
@@ -10,12 +13,19 @@ struct Node {
     struct Node* right;    // Pointer to the right child
 };
 
+// Counters for this tree (no-op unless compiled with -DINSTRUMENT)
+STATS_DEFINE("binary_search_tree");
+
+// Filter of the values in the tree (no-op unless compiled with -DBLOOM_FILTER)
+BLOOM_DEFINE();
+
 /////////////////////////////////////
 // FUNCTION TO CREATE A NEW NODE
 /////////////////////////////////////
 struct Node* createNode(int value) {
     // Allocate memory for a new node
     struct Node* newNode = (struct Node*)malloc(sizeof(struct Node));
+    STAT_ALLOC(sizeof(struct Node));
 
     // Assign the given value to the node
     newNode->data = value;
@@ -35,15 +45,18 @@ struct Node* createNode(int value) {
 // (Left subtree < Root < Right subtree)
 struct Node* insertNode(struct Node* root, int value) {
     // If tree is empty, create a new node
-    if (root == NULL)
+    if (root == NULL) {
+        BLOOM_ADD(value);
         return createNode(value);
+    }
+    STAT_VISIT();
 
     // If the value is smaller, go to the left subtree
-    if (value < root->data)
+    if (STAT_CMP(value < root->data))
         root->left = insertNode(root->left, value);
 
     // If the value is larger, go to the right subtree
-    else if (value > root->data)
+    else if (STAT_CMP(value > root->data))
         root->right = insertNode(root->right, value);
 
     // If the value already exists, do not insert (BSTs do not allow duplicates)
@@ -60,8 +73,10 @@ struct Node* insertNode(struct Node* root, int value) {
 // This is used while deleting a node with two children.
 struct Node* findMin(struct Node* root) {
     // Move to the leftmost node (smallest value in BST)
-    while (root && root->left != NULL)
+    while (root && root->left != NULL) {
+        STAT_VISIT();
         root = root->left;
+    }
 
     return root; // Return the node with the minimum value
 }
@@ -72,22 +87,29 @@ struct Node* findMin(struct Node* root) {
 struct Node* deleteNode(struct Node* root, int value) {
     // If the tree is empty
     if (root == NULL) {
+        BLOOM_FALSE_POSITIVE();   // Only reached if the filter let it through
         printf("Value not found.\n");
         return NULL;
     }
+    STAT_VISIT();
 
     // If the value to delete is smaller than root's value → go left
-    if (value < root->data)
+    if (STAT_CMP(value < root->data))
         root->left = deleteNode(root->left, value);
 
     // If the value to delete is greater than root's value → go right
-    else if (value > root->data)
+    else if (STAT_CMP(value > root->data))
         root->right = deleteNode(root->right, value);
 
     // Node to be deleted found
     else {
+        // Cases 1-3 free this node; its bits stay set in the filter
+        if (root->left == NULL || root->right == NULL)
+            BLOOM_REMOVED();
+
         // CASE 1: Node has no children (leaf node)
         if (root->left == NULL && root->right == NULL) {
+            STAT_FREE(sizeof(struct Node));
             free(root);   // Free memory
             return NULL;  // Return NULL to parent
         }
@@ -95,6 +117,7 @@ struct Node* deleteNode(struct Node* root, int value) {
         // CASE 2: Node has only one child (right)
         else if (root->left == NULL) {
             struct Node* temp = root->right;
+            STAT_FREE(sizeof(struct Node));
             free(root);   // Delete current node
             return temp;  // Replace with right child
         }
@@ -102,6 +125,7 @@ struct Node* deleteNode(struct Node* root, int value) {
         // CASE 3: Node has only one child (left)
         else if (root->right == NULL) {
             struct Node* temp = root->left;
+            STAT_FREE(sizeof(struct Node));
             free(root);   // Delete current node
             return temp;  // Replace with left child
         }
@@ -126,11 +150,12 @@ struct Node* deleteNode(struct Node* root, int value) {
 /////////////////////////////////////
 struct Node* searchNode(struct Node* root, int value) {
     // Base case: root is NULL or value found
-    if (root == NULL || root->data == value)
+    if (root == NULL || STAT_CMP(root->data == value))
         return root;
+    STAT_VISIT();
 
     // If value is smaller, search in left subtree
-    if (value < root->data)
+    if (STAT_CMP(value < root->data))
         return searchNode(root->left, value);
     else // Otherwise, search in right subtree
         return searchNode(root->right, value);
@@ -143,8 +168,9 @@ struct Node* searchNode(struct Node* root, int value) {
 void inorder(struct Node* root) {
     if (root == NULL)
         return;
+    STAT_VISIT();
     inorder(root->left);
-    printf("%d ", root->data);
+    OUT_INT(root->data, " ");
     inorder(root->right);
 }
 
@@ -154,7 +180,8 @@ void inorder(struct Node* root) {
 void preorder(struct Node* root) {
     if (root == NULL)
         return;
-    printf("%d ", root->data);
+    STAT_VISIT();
+    OUT_INT(root->data, " ");
     preorder(root->left);
     preorder(root->right);
 }
@@ -165,9 +192,214 @@ void preorder(struct Node* root) {
 void postorder(struct Node* root) {
     if (root == NULL)
         return;
+    STAT_VISIT();
     postorder(root->left);
     postorder(root->right);
-    printf("%d ", root->data);
+    OUT_INT(root->data, " ");
+}
+
+/////////////////////////////////////
+// HEIGHT OF THE TREE (number of levels)
+/////////////////////////////////////
+int treeHeight(struct Node* root) {
+    if (root == NULL)
+        return 0;
+    int lh = treeHeight(root->left);
+    int rh = treeHeight(root->right);
+    return 1 + (lh > rh ? lh : rh);
+}
+
+/////////////////////////////////////
+// FREE EVERY NODE OF A TREE
+/////////////////////////////////////
+void freeTree(struct Node* root) {
+    if (root == NULL)
+        return;
+    freeTree(root->left);
+    freeTree(root->right);
+    STAT_FREE(sizeof(struct Node));
+    free(root);
+}
+
+/* ----------------------- SET ALGEBRA -----------------------
+   Union, intersection and difference of two BSTs in O(n + m),
+   instead of one searchNode in the other tree per value.
+   Both trees are walked in sorted order at the same time, like
+   merging two sorted lists, with the Morris inorder walk of
+   05_binaryTree.c turned into an iterator (no stack, O(1) space).
+   The result is built balanced straight from the merged stream:
+   one pass counts its values, a second pass builds the tree from
+   the middle out as the values come in sorted order.
+   A walk leaves temporary threads in its tree until it reaches the
+   end, so every merge runs both walks to the end. The two trees
+   must be different trees (two walks would clash on one tree).
+------------------------------------------------------------*/
+
+enum SetOp { SET_UNION, SET_INTERSECT, SET_DIFFERENCE };
+
+// Morris inorder walk, one node per call
+struct InorderIter {
+    struct Node* curr;
+};
+
+// Returns the next node in sorted order, or NULL at the end
+struct Node* iterNext(struct InorderIter* it) {
+    while (it->curr != NULL) {
+        struct Node* curr = it->curr;
+
+        if (curr->left == NULL) {
+            STAT_VISIT();
+            it->curr = curr->right;     // May follow a thread
+            return curr;
+        }
+
+        // Find the inorder predecessor of curr
+        struct Node* pred = curr->left;
+        while (pred->right != NULL && pred->right != curr) {
+            STAT_VISIT();
+            pred = pred->right;
+        }
+
+        if (pred->right == NULL) {
+            pred->right = curr;         // First visit: make the thread
+            it->curr = curr->left;
+        } else {
+            pred->right = NULL;         // Second visit: remove the thread
+            STAT_VISIT();
+            it->curr = curr->right;
+            return curr;
+        }
+    }
+    return NULL;
+}
+
+// Both walks and the current node of each
+struct SetMerge {
+    enum SetOp op;
+    struct InorderIter a, b;
+    struct Node* x;     // Current node of tree a (NULL: a is done)
+    struct Node* y;     // Current node of tree b
+};
+
+void mergeStart(struct SetMerge* m, struct Node* a, struct Node* b, enum SetOp op) {
+    m->op = op;
+    m->a.curr = a;
+    m->b.curr = b;
+    m->x = iterNext(&m->a);
+    m->y = iterNext(&m->b);
+}
+
+// Stores the next value of the result in *value and returns 1, or
+// returns 0 once both walks are done
+int mergeNext(struct SetMerge* m, int* value) {
+    while (m->x != NULL || m->y != NULL) {
+        // Only in a
+        if (m->y == NULL || (m->x != NULL && STAT_CMP(m->x->data < m->y->data))) {
+            *value = m->x->data;
+            m->x = iterNext(&m->a);
+            if (m->op != SET_INTERSECT)
+                return 1;
+        }
+        // Only in b
+        else if (m->x == NULL || STAT_CMP(m->y->data < m->x->data)) {
+            *value = m->y->data;
+            m->y = iterNext(&m->b);
+            if (m->op == SET_UNION)
+                return 1;
+        }
+        // In both
+        else {
+            *value = m->x->data;
+            m->x = iterNext(&m->a);
+            m->y = iterNext(&m->b);
+            if (m->op != SET_DIFFERENCE)
+                return 1;
+        }
+    }
+    return 0;
+}
+
+// Number of values in the result, without allocating anything
+int setCount(struct Node* a, struct Node* b, enum SetOp op) {
+    struct SetMerge m;
+    int count = 0, value;
+
+    mergeStart(&m, a, b, op);
+    while (mergeNext(&m, &value))
+        count++;
+    return count;
+}
+
+int bstUnionCount(struct Node* a, struct Node* b)      { return setCount(a, b, SET_UNION); }
+int bstIntersectCount(struct Node* a, struct Node* b)  { return setCount(a, b, SET_INTERSECT); }
+int bstDifferenceCount(struct Node* a, struct Node* b) { return setCount(a, b, SET_DIFFERENCE); }
+
+// Builds a balanced tree of the next 'n' values of the merge:
+// left half first, then the middle value, then the right half
+struct Node* buildFromMerge(struct SetMerge* m, int n) {
+    int value;
+
+    if (n == 0)
+        return NULL;
+
+    struct Node* left = buildFromMerge(m, n / 2);
+    mergeNext(m, &value);
+    struct Node* node = createNode(value);
+    node->left = left;
+    node->right = buildFromMerge(m, n - n / 2 - 1);
+    return node;
+}
+
+// New balanced tree holding the result; a and b are not changed
+struct Node* setBuild(struct Node* a, struct Node* b, enum SetOp op) {
+    struct SetMerge m;
+    int n = setCount(a, b, op), value;
+
+    mergeStart(&m, a, b, op);
+    struct Node* result = buildFromMerge(&m, n);
+    while (mergeNext(&m, &value))   // Finish both walks (removes any threads left)
+        ;
+    return result;
+}
+
+// Values in a or in b
+struct Node* bstUnion(struct Node* a, struct Node* b)      { return setBuild(a, b, SET_UNION); }
+// Values in both a and b
+struct Node* bstIntersect(struct Node* a, struct Node* b)  { return setBuild(a, b, SET_INTERSECT); }
+// Values in a but not in b
+struct Node* bstDifference(struct Node* a, struct Node* b) { return setBuild(a, b, SET_DIFFERENCE); }
+
+// Reads 'n' values into a new tree (for the other operand)
+struct Node* readTree(int n) {
+    struct Node* other = NULL;
+    int i, value;
+
+    printf("Enter %d values: ", n);
+    for (i = 0; i < n; i++) {
+        scanf("%d", &value);
+        other = insertNode(other, value);
+    }
+    return other;
+}
+
+/////////////////////////////////////
+// REBUILD THE BLOOM FILTER WHEN IT HAS GONE STALE
+/////////////////////////////////////
+// Deleted values leave their bits set, so after many deletes the
+// filter lets more misses through; it is then refilled from the tree.
+void addTreeToBloom(struct Node* root) {
+    if (root == NULL)
+        return;
+    BLOOM_ADD(root->data);
+    addTreeToBloom(root->left);
+    addTreeToBloom(root->right);
+}
+
+void refreshBloom(struct Node* root) {
+    if (BLOOM_NEEDS_REBUILD()) {
+        BLOOM_REBUILD();
+        addTreeToBloom(root);
+    }
 }
 
 /////////////////////////////////////
@@ -175,10 +407,14 @@ void postorder(struct Node* root) {
 /////////////////////////////////////
 int main() {
     struct Node* root = NULL; // Start with an empty tree
-    int choice, value;
+    int choice, value, n;
     struct Node* found; // Used for search results
+    struct Node* other; // Second tree of a set operation
+    struct Node* result;
 
     while (1) {
+        refreshBloom(root);
+
         printf("\n--- BINARY SEARCH TREE OPERATIONS ---\n");
         printf("1. Insert Node\n");
         printf("2. Delete Node\n");
@@ -186,6 +422,10 @@ int main() {
         printf("4. Inorder Traversal\n");
         printf("5. Preorder Traversal\n");
         printf("6. Postorder Traversal\n");
+        printf("8. Union with Another Tree\n");
+        printf("9. Intersection with Another Tree\n");
+        printf("10. Difference with Another Tree\n");
+        printf("11. Count Union / Intersection / Difference\n");
         printf("7. Exit\n");
         printf("Enter your choice: ");
         scanf("%d", &choice);
@@ -202,6 +442,11 @@ int main() {
             case 2:
                 printf("Enter value to delete: ");
                 scanf("%d", &value);
+                // A value the filter has never seen is not in the tree
+                if (!BLOOM_MAY_CONTAIN(value)) {
+                    printf("Value not found.\n");
+                    break;
+                }
                 root = deleteNode(root, value);
                 break;
 
@@ -209,7 +454,13 @@ int main() {
             case 3:
                 printf("Enter value to search: ");
                 scanf("%d", &value);
-                found = searchNode(root, value);
+                found = NULL;
+                // A value the filter has never seen is not in the tree
+                if (BLOOM_MAY_CONTAIN(value)) {
+                    found = searchNode(root, value);
+                    if (found == NULL)
+                        BLOOM_FALSE_POSITIVE();
+                }
                 if (found != NULL)
                     printf("Value %d found in BST.\n", value);
                 else
@@ -220,28 +471,77 @@ int main() {
             case 4:
                 printf("Inorder Traversal: ");
                 inorder(root);
-                printf("\n");
+                OUT_TEXT("\n");
+                OUT_FLUSH();
                 break;
 
             // Display preorder traversal
             case 5:
                 printf("Preorder Traversal: ");
                 preorder(root);
-                printf("\n");
+                OUT_TEXT("\n");
+                OUT_FLUSH();
                 break;
 
             // Display postorder traversal
             case 6:
                 printf("Postorder Traversal: ");
                 postorder(root);
-                printf("\n");
+                OUT_TEXT("\n");
+                OUT_FLUSH();
                 break;
 
             // Exit the program
             case 7:
                 printf("Exiting program...\n");
+                STAT_HEIGHT(treeHeight(root));
+                STATS_DUMP();
+                BLOOM_REPORT();
                 exit(0);
 
+            // Added later, so they take new numbers and the
+            // original choices (and scripted input) keep working
+            // Replace the tree by its union / intersection / difference
+            // with a second tree
+            case 8:
+            case 9:
+            case 10:
+                printf("Enter number of values in the other tree: ");
+                scanf("%d", &n);
+                other = readTree(n);
+                if (choice == 8)
+                    result = bstUnion(root, other);
+                else if (choice == 9)
+                    result = bstIntersect(root, other);
+                else
+                    result = bstDifference(root, other);
+                freeTree(root);
+                freeTree(other);
+                root = result;
+
+                // The filter also saw the other tree's values
+                BLOOM_REBUILD();
+                addTreeToBloom(root);
+
+                printf("Result (height %d): ", treeHeight(root));
+                inorder(root);
+                OUT_TEXT("\n");
+                OUT_FLUSH();
+                break;
+
+            // Sizes of all three results, without building them
+            case 11:
+                printf("Enter number of values in the other tree: ");
+                scanf("%d", &n);
+                other = readTree(n);
+                printf("Union: %d, Intersection: %d, Difference: %d\n",
+                       bstUnionCount(root, other), bstIntersectCount(root, other),
+                       bstDifferenceCount(root, other));
+                freeTree(other);
+                BLOOM_REBUILD();
+                addTreeToBloom(root);
+                break;
+
             // Handle invalid input
             default:
                 printf("Invalid choice! Try again.\n");
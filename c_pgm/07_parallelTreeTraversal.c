@@ -0,0 +1,728 @@
+// Compile with: gcc -O2 -pthread 07_parallelTreeTraversal.c -o parallelTree
+#include <stdio.h>
+#include <stdlib.h>
+#include <limits.h>
+#include <pthread.h>
+#include <sched.h>
+#include <stdatomic.h>
+#include <time.h>
+#include <unistd.h>
+
+#define MAX_WORKERS 64        // Upper limit on threads in the pool
+#define SEQUENTIAL_CUTOFF 12  // Subtrees below this depth are walked by one thread
+
+// Structure definition for a node in the tree
+// (same layout as in 05_binaryTree.c and 06_binarySearchTree.c)
+struct Node {
+    int data;               // Value of the node
+    struct Node* left;      // Pointer to the left child
+    struct Node* right;     // Pointer to the right child
+};
+
+// A user-supplied reduction:
+// every value is turned into a number by 'map', and the numbers are
+// folded together with 'combine'. 'combine' must be associative and
+// commutative because subtrees finish in any order.
+struct Reducer {
+    long long identity;                           // Result for an empty tree
+    long long (*map)(int value, void* ctx);       // Value -> partial result
+    long long (*combine)(long long a, long long b);
+    void* ctx;                                    // Extra data for 'map'
+};
+
+// One unit of work: a subtree and its depth in the whole tree
+struct Task {
+    struct Node* node;
+    int depth;
+    int slot;   // Index into the export table (ordered export only)
+};
+
+// Per-worker double ended queue of tasks.
+// The owner pushes and pops at the tail (LIFO, good locality),
+// other workers steal from the head (the oldest, biggest subtrees).
+struct TaskDeque {
+    struct Task* items;
+    int head, tail, capacity;
+    pthread_mutex_t lock;
+};
+
+// One piece of the in-order export: either a single node near the top
+// of the tree or a whole subtree that starts at the cutoff depth.
+struct ExportEntry {
+    struct Node* node;
+    int isSubtree;
+    long count;     // Number of values this entry produces
+    long offset;    // Where its first value goes in the output array
+};
+
+struct ThreadPool;
+
+struct Worker {
+    int id;
+    struct ThreadPool* pool;
+    struct TaskDeque deque;
+    long long acc;        // Worker-local partial result of a reduction
+    unsigned seed;        // For choosing random victims to steal from
+};
+
+struct ThreadPool {
+    int size;
+    struct Worker workers[MAX_WORKERS];
+    pthread_t threads[MAX_WORKERS];
+
+    pthread_mutex_t lock;
+    pthread_cond_t wake;      // Signalled when a new job starts
+    pthread_cond_t finished;  // Signalled when the last worker is done
+    int generation;           // Incremented for every job
+    int running;              // Workers still busy with the current job
+    int shutdown;
+
+    atomic_long pending;      // Tasks spawned but not yet finished
+
+    // Description of the current job
+    void (*run)(struct Worker* w, struct Task t);
+    const struct Reducer* reducer;
+    void (*visit)(int value, void* ctx);
+    void* visitCtx;
+    struct ExportEntry* entries;
+    int* out;
+};
+
+/* ---------------------- TREE BASICS ---------------------- */
+
+// Function to create a new node with given value
+struct Node* createNode(int value) {
+    struct Node* newNode = (struct Node*)malloc(sizeof(struct Node));
+    newNode->data = value;
+    newNode->left = NULL;
+    newNode->right = NULL;
+    return newNode;
+}
+
+// Inserts a value following BST rules (duplicates are ignored).
+// Written as a loop so bulk loading does not recurse.
+// Returns 1 if the value was inserted, 0 if it was a duplicate.
+int insertNode(struct Node** root, int value) {
+    struct Node** link = root;
+
+    while (*link != NULL) {
+        if (value < (*link)->data)
+            link = &(*link)->left;
+        else if (value > (*link)->data)
+            link = &(*link)->right;
+        else
+            return 0;
+    }
+
+    *link = createNode(value);
+    return 1;
+}
+
+// Sequential inorder walk: calls visit(value, ctx) for every node.
+// Sorted inserts build a list-shaped tree millions of levels deep, so
+// the walk keeps its own stack on the heap instead of recursing (a
+// worker thread's stack would overflow long before that).
+void walkInorder(struct Node* root, void (*visit)(int, void*), void* ctx) {
+    long size = 0, capacity = 64;
+    struct Node** stack = (struct Node**)malloc(capacity * sizeof(struct Node*));
+    struct Node* node = root;
+
+    while (node != NULL || size > 0) {
+        // Go down the left spine, remembering the nodes on the way
+        while (node != NULL) {
+            if (size == capacity) {
+                capacity *= 2;
+                stack = (struct Node**)realloc(stack, capacity * sizeof(struct Node*));
+            }
+            stack[size++] = node;
+            node = node->left;
+        }
+        node = stack[--size];
+        visit(node->data, ctx);
+        node = node->right;
+    }
+    free(stack);
+}
+
+void printValue(int value, void* ctx) {
+    (void)ctx;
+    printf("%d ", value);
+}
+
+void countValue(int value, void* ctx) {
+    (void)value;
+    (*(long*)ctx)++;
+}
+
+// Inorder Traversal: Left → Root → Right (sequential, for comparison)
+void inorder(struct Node* root) {
+    walkInorder(root, printValue, NULL);
+}
+
+// Sequential count, used as the baseline and inside the cutoff
+long countNodes(struct Node* root) {
+    long count = 0;
+    walkInorder(root, countValue, &count);
+    return count;
+}
+
+// Frees every node. Rotating each left child up until the node has
+// none turns the tree into a right-leaning list without recursion.
+void freeTree(struct Node* root) {
+    while (root != NULL) {
+        if (root->left != NULL) {
+            struct Node* left = root->left;
+            root->left = left->right;
+            left->right = root;
+            root = left;
+        } else {
+            struct Node* next = root->right;
+            free(root);
+            root = next;
+        }
+    }
+}
+
+/* -------------------- TASK DEQUE ------------------------ */
+
+void initDeque(struct TaskDeque* d) {
+    d->capacity = 64;
+    d->items = (struct Task*)malloc(d->capacity * sizeof(struct Task));
+    d->head = d->tail = 0;
+    pthread_mutex_init(&d->lock, NULL);
+}
+
+// Owner side: push a task at the tail
+void pushTask(struct TaskDeque* d, struct Task t) {
+    pthread_mutex_lock(&d->lock);
+
+    if (d->tail == d->capacity) {
+        if (d->head > 0) {
+            // Slide live tasks back to the start before growing
+            int live = d->tail - d->head;
+            for (int i = 0; i < live; i++)
+                d->items[i] = d->items[d->head + i];
+            d->head = 0;
+            d->tail = live;
+        }
+        if (d->tail == d->capacity) {
+            d->capacity *= 2;
+            d->items = (struct Task*)realloc(d->items, d->capacity * sizeof(struct Task));
+        }
+    }
+
+    d->items[d->tail++] = t;
+    pthread_mutex_unlock(&d->lock);
+}
+
+// Owner side: pop the newest task. Returns 0 if empty.
+int popTask(struct TaskDeque* d, struct Task* t) {
+    int ok = 0;
+    pthread_mutex_lock(&d->lock);
+    if (d->tail > d->head) {
+        *t = d->items[--d->tail];
+        ok = 1;
+    }
+    if (d->tail == d->head)
+        d->head = d->tail = 0;
+    pthread_mutex_unlock(&d->lock);
+    return ok;
+}
+
+// Thief side: take the oldest task. Returns 0 if empty.
+int stealTask(struct TaskDeque* d, struct Task* t) {
+    int ok = 0;
+    pthread_mutex_lock(&d->lock);
+    if (d->tail > d->head) {
+        *t = d->items[d->head++];
+        ok = 1;
+    }
+    pthread_mutex_unlock(&d->lock);
+    return ok;
+}
+
+/* -------------------- THREAD POOL ------------------------ */
+
+// Makes a task visible to the pool. The pending counter is raised
+// first so no worker can see zero while the task is being queued.
+void spawnTask(struct Worker* w, struct Task t) {
+    atomic_fetch_add(&w->pool->pending, 1);
+    pushTask(&w->deque, t);
+}
+
+// Tries the other workers' deques starting from a random victim
+int stealFromOthers(struct Worker* w, struct Task* t) {
+    struct ThreadPool* pool = w->pool;
+    int start = rand_r(&w->seed) % pool->size;
+
+    for (int i = 0; i < pool->size; i++) {
+        int victim = (start + i) % pool->size;
+        if (victim != w->id && stealTask(&pool->workers[victim].deque, t))
+            return 1;
+    }
+    return 0;
+}
+
+// Work loop of one job: run own tasks, steal when idle,
+// stop when no task is left anywhere in the pool
+void runTasks(struct Worker* w) {
+    struct ThreadPool* pool = w->pool;
+    struct Task t;
+
+    while (1) {
+        if (popTask(&w->deque, &t) || stealFromOthers(w, &t)) {
+            pool->run(w, t);
+            atomic_fetch_sub(&pool->pending, 1);
+        } else if (atomic_load(&pool->pending) == 0) {
+            break;
+        } else {
+            sched_yield();
+        }
+    }
+}
+
+void* workerMain(void* arg) {
+    struct Worker* w = (struct Worker*)arg;
+    struct ThreadPool* pool = w->pool;
+    int seen = 0;
+
+    while (1) {
+        // Sleep until the next job (or shutdown)
+        pthread_mutex_lock(&pool->lock);
+        while (pool->generation == seen && !pool->shutdown)
+            pthread_cond_wait(&pool->wake, &pool->lock);
+        if (pool->shutdown) {
+            pthread_mutex_unlock(&pool->lock);
+            return NULL;
+        }
+        seen = pool->generation;
+        pthread_mutex_unlock(&pool->lock);
+
+        runTasks(w);
+
+        pthread_mutex_lock(&pool->lock);
+        if (--pool->running == 0)
+            pthread_cond_signal(&pool->finished);
+        pthread_mutex_unlock(&pool->lock);
+    }
+}
+
+// Starts one thread per online CPU (at least one)
+void createPool(struct ThreadPool* pool) {
+    long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    if (cpus < 1)
+        cpus = 1;
+    if (cpus > MAX_WORKERS)
+        cpus = MAX_WORKERS;
+
+    pool->size = (int)cpus;
+    pool->generation = 0;
+    pool->running = 0;
+    pool->shutdown = 0;
+    atomic_init(&pool->pending, 0);
+    pthread_mutex_init(&pool->lock, NULL);
+    pthread_cond_init(&pool->wake, NULL);
+    pthread_cond_init(&pool->finished, NULL);
+
+    for (int i = 0; i < pool->size; i++) {
+        struct Worker* w = &pool->workers[i];
+        w->id = i;
+        w->pool = pool;
+        w->seed = 12345u + (unsigned)i;
+        initDeque(&w->deque);
+    }
+    for (int i = 0; i < pool->size; i++)
+        pthread_create(&pool->threads[i], NULL, workerMain, &pool->workers[i]);
+}
+
+void destroyPool(struct ThreadPool* pool) {
+    pthread_mutex_lock(&pool->lock);
+    pool->shutdown = 1;
+    pthread_cond_broadcast(&pool->wake);
+    pthread_mutex_unlock(&pool->lock);
+
+    for (int i = 0; i < pool->size; i++) {
+        pthread_join(pool->threads[i], NULL);
+        free(pool->workers[i].deque.items);
+    }
+}
+
+// Wakes all workers for the job described in 'pool' and waits
+// until every task (including stolen and spawned ones) has finished.
+// Initial tasks must already be queued with spawnTask.
+void runJob(struct ThreadPool* pool) {
+    pthread_mutex_lock(&pool->lock);
+    pool->running = pool->size;
+    pool->generation++;
+    pthread_cond_broadcast(&pool->wake);
+    while (pool->running > 0)
+        pthread_cond_wait(&pool->finished, &pool->lock);
+    pthread_mutex_unlock(&pool->lock);
+}
+
+/* ---------------- PARALLEL REDUCTIONS -------------------- */
+
+struct Fold {
+    const struct Reducer* reducer;
+    long long acc;
+};
+
+void foldValue(int value, void* ctx) {
+    struct Fold* fold = (struct Fold*)ctx;
+    const struct Reducer* r = fold->reducer;
+    fold->acc = r->combine(fold->acc, r->map(value, r->ctx));
+}
+
+// Sequential fold of a whole subtree
+long long reduceSequential(struct Node* root, const struct Reducer* r) {
+    struct Fold fold = { r, r->identity };
+    walkInorder(root, foldValue, &fold);
+    return fold.acc;
+}
+
+// Above the cutoff: hand the right child to the pool and keep going
+// down the left spine. Below it: finish the subtree on this thread.
+void reduceTask(struct Worker* w, struct Task t) {
+    const struct Reducer* r = w->pool->reducer;
+    struct Node* node = t.node;
+    int depth = t.depth;
+
+    while (node != NULL && depth < SEQUENTIAL_CUTOFF) {
+        if (node->right != NULL)
+            spawnTask(w, (struct Task){ node->right, depth + 1, 0 });
+        w->acc = r->combine(w->acc, r->map(node->data, r->ctx));
+        node = node->left;
+        depth++;
+    }
+    w->acc = r->combine(w->acc, reduceSequential(node, r));
+}
+
+long long parallelReduce(struct ThreadPool* pool, struct Node* root, const struct Reducer* r) {
+    if (root == NULL)
+        return r->identity;
+
+    for (int i = 0; i < pool->size; i++)
+        pool->workers[i].acc = r->identity;
+
+    pool->run = reduceTask;
+    pool->reducer = r;
+    spawnTask(&pool->workers[0], (struct Task){ root, 0, 0 });
+    runJob(pool);
+
+    // Combine the worker-local partial results
+    long long result = r->identity;
+    for (int i = 0; i < pool->size; i++)
+        result = r->combine(result, pool->workers[i].acc);
+    return result;
+}
+
+// Ready-made reducers for the common aggregates
+long long mapOne(int value, void* ctx) { (void)value; (void)ctx; return 1; }
+long long mapValue(int value, void* ctx) { (void)ctx; return value; }
+long long combineAdd(long long a, long long b) { return a + b; }
+long long combineMin(long long a, long long b) { return a < b ? a : b; }
+long long combineMax(long long a, long long b) { return a > b ? a : b; }
+
+long parallelCount(struct ThreadPool* pool, struct Node* root) {
+    struct Reducer r = { 0, mapOne, combineAdd, NULL };
+    return (long)parallelReduce(pool, root, &r);
+}
+
+long long parallelSum(struct ThreadPool* pool, struct Node* root) {
+    struct Reducer r = { 0, mapValue, combineAdd, NULL };
+    return parallelReduce(pool, root, &r);
+}
+
+// Minimum and maximum of any binary tree (not only a BST).
+// Return 0 if the tree is empty.
+int parallelMinMax(struct ThreadPool* pool, struct Node* root, int* min, int* max) {
+    if (root == NULL)
+        return 0;
+    struct Reducer rmin = { LLONG_MAX, mapValue, combineMin, NULL };
+    struct Reducer rmax = { LLONG_MIN, mapValue, combineMax, NULL };
+    *min = (int)parallelReduce(pool, root, &rmin);
+    *max = (int)parallelReduce(pool, root, &rmax);
+    return 1;
+}
+
+/* ------------------- PARALLEL VISIT ---------------------- */
+
+void visitTask(struct Worker* w, struct Task t) {
+    struct ThreadPool* pool = w->pool;
+    struct Node* node = t.node;
+    int depth = t.depth;
+
+    while (node != NULL && depth < SEQUENTIAL_CUTOFF) {
+        if (node->right != NULL)
+            spawnTask(w, (struct Task){ node->right, depth + 1, 0 });
+        pool->visit(node->data, pool->visitCtx);
+        node = node->left;
+        depth++;
+    }
+    walkInorder(node, pool->visit, pool->visitCtx);
+}
+
+// Calls visit(value, ctx) once for every node, from several threads
+// and in no particular order. 'visit' must be thread safe.
+void parallelVisit(struct ThreadPool* pool, struct Node* root,
+                   void (*visit)(int, void*), void* ctx) {
+    if (root == NULL)
+        return;
+    pool->run = visitTask;
+    pool->visit = visit;
+    pool->visitCtx = ctx;
+    spawnTask(&pool->workers[0], (struct Task){ root, 0, 0 });
+    runJob(pool);
+}
+
+/* ------------------ ORDERED EXPORT ----------------------- */
+
+// Walks the top of the tree in order and records, left to right,
+// every node above the cutoff and every subtree starting at it.
+void collectEntries(struct Node* root, int depth, struct ExportEntry** entries,
+                    int* n, int* capacity) {
+    if (root == NULL)
+        return;
+
+    if (depth < SEQUENTIAL_CUTOFF)
+        collectEntries(root->left, depth + 1, entries, n, capacity);
+
+    if (*n == *capacity) {
+        *capacity *= 2;
+        *entries = (struct ExportEntry*)realloc(*entries, *capacity * sizeof(struct ExportEntry));
+    }
+    (*entries)[*n].node = root;
+    (*entries)[*n].isSubtree = (depth >= SEQUENTIAL_CUTOFF);
+    (*entries)[*n].count = 1;
+    (*n)++;
+
+    if (depth < SEQUENTIAL_CUTOFF)
+        collectEntries(root->right, depth + 1, entries, n, capacity);
+}
+
+void countEntryTask(struct Worker* w, struct Task t) {
+    struct ExportEntry* e = &w->pool->entries[t.slot];
+    e->count = countNodes(e->node);
+}
+
+struct Writer {
+    int* out;
+    long pos;
+};
+
+void writeValue(int value, void* ctx) {
+    struct Writer* writer = (struct Writer*)ctx;
+    writer->out[writer->pos++] = value;
+}
+
+// Writes the entry's subtree in order into its slice of the output
+void exportEntryTask(struct Worker* w, struct Task t) {
+    struct ExportEntry* e = &w->pool->entries[t.slot];
+    struct Writer writer = { w->pool->out, e->offset };
+    walkInorder(e->node, writeValue, &writer);
+}
+
+// Queues one task per subtree entry for the given job body
+void runEntryJob(struct ThreadPool* pool, struct ExportEntry* entries, int n,
+                 void (*run)(struct Worker*, struct Task)) {
+    pool->run = run;
+    pool->entries = entries;
+    for (int i = 0; i < n; i++)
+        if (entries[i].isSubtree)
+            spawnTask(&pool->workers[i % pool->size], (struct Task){ entries[i].node, SEQUENTIAL_CUTOFF, i });
+    runJob(pool);
+}
+
+// Ordered export: returns a malloc'ed array with the values in
+// inorder sequence and stores its length in *count.
+// 1. split the tree into entries at the cutoff depth,
+// 2. count every subtree in parallel,
+// 3. turn the counts into output offsets (prefix sums),
+// 4. let every subtree write its own slice in parallel.
+int* parallelExportInorder(struct ThreadPool* pool, struct Node* root, long* count) {
+    int n = 0, capacity = 256;
+    struct ExportEntry* entries = (struct ExportEntry*)malloc(capacity * sizeof(struct ExportEntry));
+
+    collectEntries(root, 0, &entries, &n, &capacity);
+    runEntryJob(pool, entries, n, countEntryTask);
+
+    long total = 0;
+    for (int i = 0; i < n; i++) {
+        entries[i].offset = total;
+        total += entries[i].count;
+    }
+
+    int* out = (int*)malloc((total > 0 ? total : 1) * sizeof(int));
+    for (int i = 0; i < n; i++)
+        if (!entries[i].isSubtree)
+            out[entries[i].offset] = entries[i].node->data;
+
+    pool->out = out;
+    runEntryJob(pool, entries, n, exportEntryTask);
+
+    free(entries);
+    *count = total;
+    return out;
+}
+
+/* -------------------- DEMO HELPERS ----------------------- */
+
+struct Range {
+    int low, high;
+};
+
+// Example user-supplied reduction: how many values lie in [low, high]
+long long mapInRange(int value, void* ctx) {
+    struct Range* range = (struct Range*)ctx;
+    return value >= range->low && value <= range->high;
+}
+
+// Example visitor: thread-safe counter of visited nodes
+void visitCount(int value, void* ctx) {
+    (void)value;
+    atomic_fetch_add((atomic_long*)ctx, 1);
+}
+
+double nowSeconds() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+void addValue(int value, void* ctx) {
+    *(long long*)ctx += value;
+}
+
+long long sumSequential(struct Node* root) {
+    long long sum = 0;
+    walkInorder(root, addValue, &sum);
+    return sum;
+}
+
+// Times the sequential and parallel count / sum on the current tree
+void compareTimings(struct ThreadPool* pool, struct Node* root) {
+    double t0 = nowSeconds();
+    long seqCount = countNodes(root);
+    long long seqSum = sumSequential(root);
+    double t1 = nowSeconds();
+    long parCount = parallelCount(pool, root);
+    long long parSum = parallelSum(pool, root);
+    double t2 = nowSeconds();
+
+    printf("Sequential: count=%ld sum=%lld in %.3f ms\n", seqCount, seqSum, (t1 - t0) * 1e3);
+    printf("Parallel (%d threads): count=%ld sum=%lld in %.3f ms\n",
+           pool->size, parCount, parSum, (t2 - t1) * 1e3);
+    if (seqCount != parCount || seqSum != parSum)
+        printf("Mismatch between sequential and parallel results!\n");
+}
+
+/* -------------------- MAIN FUNCTION ---------------------
+   Menu-driven program to test the parallel tree operations
+-----------------------------------------------------------*/
+int main() {
+    struct Node* root = NULL;
+    struct ThreadPool pool;
+    int choice, value, min, max, i;
+    long n;
+    struct Range range;
+    atomic_long visited;
+
+    createPool(&pool);
+
+    while (1) {
+        printf("\n--- PARALLEL TREE TRAVERSALS (%d threads) ---\n", pool.size);
+        printf("1. Insert Node\n");
+        printf("2. Insert N Random Nodes\n");
+        printf("3. Inorder Traversal (sequential)\n");
+        printf("4. Parallel Count\n");
+        printf("5. Parallel Sum\n");
+        printf("6. Parallel Min / Max\n");
+        printf("7. Parallel Count in Range (user reduction)\n");
+        printf("8. Parallel Visit All Nodes\n");
+        printf("9. Parallel Ordered (Inorder) Export\n");
+        printf("10. Compare Sequential vs Parallel\n");
+        printf("11. Exit\n");
+        printf("Enter your choice: ");
+        if (scanf("%d", &choice) != 1)
+            break;
+
+        switch (choice) {
+            case 1:
+                printf("Enter value to insert: ");
+                scanf("%d", &value);
+                if (!insertNode(&root, value))
+                    printf("Duplicate value! Ignored.\n");
+                break;
+
+            case 2:
+                printf("Enter number of nodes: ");
+                scanf("%ld", &n);
+                for (i = 0; i < n; i++)
+                    insertNode(&root, rand());
+                printf("Tree now has %ld nodes.\n", parallelCount(&pool, root));
+                break;
+
+            case 3:
+                printf("Inorder Traversal: ");
+                inorder(root);
+                printf("\n");
+                break;
+
+            case 4:
+                printf("Total number of nodes: %ld\n", parallelCount(&pool, root));
+                break;
+
+            case 5:
+                printf("Sum of all values: %lld\n", parallelSum(&pool, root));
+                break;
+
+            case 6:
+                if (parallelMinMax(&pool, root, &min, &max))
+                    printf("Min: %d  Max: %d\n", min, max);
+                else
+                    printf("Tree is empty.\n");
+                break;
+
+            case 7: {
+                printf("Enter low and high: ");
+                scanf("%d %d", &range.low, &range.high);
+                struct Reducer r = { 0, mapInRange, combineAdd, &range };
+                printf("Values in range: %lld\n", parallelReduce(&pool, root, &r));
+                break;
+            }
+
+            case 8:
+                atomic_init(&visited, 0);
+                parallelVisit(&pool, root, visitCount, &visited);
+                printf("Visited %ld nodes.\n", atomic_load(&visited));
+                break;
+
+            case 9: {
+                int* values = parallelExportInorder(&pool, root, &n);
+                printf("Inorder Export (%ld values): ", n);
+                for (i = 0; i < n; i++)
+                    printf("%d ", values[i]);
+                printf("\n");
+                free(values);
+                break;
+            }
+
+            case 10:
+                compareTimings(&pool, root);
+                break;
+
+            case 11:
+                printf("Exiting program...\n");
+                destroyPool(&pool);
+                freeTree(root);
+                exit(0);
+
+            default:
+                printf("Invalid choice! Try again.\n");
+        }
+    }
+
+    destroyPool(&pool);
+    freeTree(root);
+    return 0;
+}
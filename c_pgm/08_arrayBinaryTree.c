@@ -0,0 +1,339 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "instrument.h"
+#include "fastout.h"
+
+#define INITIAL_CAPACITY 16  // Starting size of the array
+
+// Set to 0 to drop the value index and find values by a linear scan
+#ifndef USE_VALUE_INDEX
+#define USE_VALUE_INDEX 1
+#endif
+
+STATS_DEFINE("array_binary_tree");
+
+#if USE_VALUE_INDEX
+// Index entries hold the array slot of a value; -1 marks a free bucket
+#define INDEX_REF   int
+#define INDEX_EMPTY -1
+#include "valueindex.h"
+#endif
+
+/* ------------- ARRAY-BACKED COMPLETE BINARY TREE -------------
+   The binary tree of 05_binaryTree.c is always complete (filled
+   level by level, left to right). A complete tree needs no pointers:
+   storing it in level order in an array, the node at index i has
+     left child  at 2*i + 1
+     right child at 2*i + 2
+     parent      at (i - 1) / 2
+   so inserting is "append at the end" and the deepest node is
+   always the last element.
+----------------------------------------------------------------*/
+struct BinaryTree {
+    int* items;     // Values in level order
+    int size;       // Number of nodes in the tree
+    int capacity;   // Allocated length of 'items'
+#if USE_VALUE_INDEX
+    struct ValueIndex index;  // value -> slot, kept in sync with 'items'
+#endif
+};
+
+// Index helpers
+int leftChild(int i) { return 2 * i + 1; }
+int rightChild(int i) { return 2 * i + 2; }
+int parent(int i) { return (i - 1) / 2; }
+
+// Function to initialize an empty tree
+void createTree(struct BinaryTree* tree) {
+    tree->items = (int*)malloc(INITIAL_CAPACITY * sizeof(int));
+    STAT_ALLOC(INITIAL_CAPACITY * sizeof(int));
+    tree->size = 0;
+    tree->capacity = INITIAL_CAPACITY;
+#if USE_VALUE_INDEX
+    initIndex(&tree->index, INITIAL_CAPACITY);
+#endif
+}
+
+/* ---------------------- INSERTION -----------------------
+   The next free position in level order is simply index 'size'.
+   The array doubles when full, so insert is O(1) amortized.
+------------------------------------------------------------*/
+void insertNode(struct BinaryTree* tree, int value) {
+    if (tree->size == tree->capacity) {
+        STAT_FREE(tree->capacity * sizeof(int));
+        tree->capacity *= 2;
+        tree->items = (int*)realloc(tree->items, tree->capacity * sizeof(int));
+        STAT_ALLOC(tree->capacity * sizeof(int));
+    }
+#if USE_VALUE_INDEX
+    indexInsert(&tree->index, value, tree->size);
+#endif
+    tree->items[tree->size++] = value;
+}
+
+/* ---------------- FIND DEEPEST NODE -------------------
+   The deepest, rightmost node is the last one in level order.
+   Returns its index, or -1 if the tree is empty.
+----------------------------------------------------------*/
+int findDeepestNode(struct BinaryTree* tree) {
+    return tree->size - 1;
+}
+
+/* ----------------- DELETE NODE -------------------------
+   Same steps as the pointer version:
+   1. Find the node to delete.
+   2. Copy the deepest node's value into it.
+   3. Drop the deepest node by shrinking the array.
+   If the value occurs more than once, the last match in level order
+   (the highest slot) is removed, as in 05_binaryTree.c. With the
+   value index, step 1 is a hash lookup over the value's entries and
+   step 2 only has to re-point the deepest value's entry, so deletion
+   is expected O(1). Without the index, step 1 scans the array.
+----------------------------------------------------------*/
+void deleteNode(struct BinaryTree* tree, int value) {
+    int keyIndex = -1;
+
+#if USE_VALUE_INDEX
+    // Of all the entries for the value, take the highest slot
+    int bucket = indexLookup(&tree->index, value, -1), next;
+    for (next = bucket; next != -1; next = indexNext(&tree->index, value, next))
+        if (tree->index.entries[next].ref > tree->index.entries[bucket].ref)
+            bucket = next;
+    if (bucket != -1) {
+        keyIndex = tree->index.entries[bucket].ref;
+        indexRemoveAt(&tree->index, bucket);
+    }
+#else
+    int i;
+    // Scanning from the end finds the last match in level order first
+    for (i = tree->size - 1; i >= 0; i--) {
+        STAT_VISIT();
+        if (STAT_CMP(tree->items[i] == value)) {
+            keyIndex = i;
+            break;
+        }
+    }
+#endif
+
+    if (keyIndex == -1) {
+        printf("Node with value %d not found.\n", value);
+        return;
+    }
+
+    int deepest = findDeepestNode(tree);
+#if USE_VALUE_INDEX
+    // The deepest value moves into keyIndex: update its entry
+    if (deepest != keyIndex) {
+        int moved = indexLookup(&tree->index, tree->items[deepest], deepest);
+        tree->index.entries[moved].ref = keyIndex;
+    }
+#endif
+    tree->items[keyIndex] = tree->items[deepest];
+    tree->size--;
+
+    // Give memory back when the tree has shrunk a lot
+    if (tree->capacity > INITIAL_CAPACITY && tree->size < tree->capacity / 4) {
+        STAT_FREE(tree->capacity * sizeof(int));
+        tree->capacity /= 2;
+        tree->items = (int*)realloc(tree->items, tree->capacity * sizeof(int));
+        STAT_ALLOC(tree->capacity * sizeof(int));
+    }
+}
+
+/* ------------------- TREE TRAVERSALS -------------------
+   All traversals move between indices with the formulas above,
+   using neither recursion nor an explicit stack or queue.
+----------------------------------------------------------*/
+
+// Inorder Traversal: Left → Root → Right
+void inorder(struct BinaryTree* tree) {
+    int n = tree->size;
+    if (n == 0)
+        return;
+
+    // Start at the leftmost node
+    int i = 0;
+    while (leftChild(i) < n)
+        i = leftChild(i);
+
+    while (1) {
+        STAT_VISIT();
+        OUT_INT(tree->items[i], " ");
+
+        if (rightChild(i) < n) {
+            // Successor is the leftmost node of the right subtree
+            i = rightChild(i);
+            while (leftChild(i) < n)
+                i = leftChild(i);
+        } else {
+            // Climb while we are a right child (even index)
+            while (i > 0 && i % 2 == 0)
+                i = parent(i);
+            if (i == 0)
+                break;        // Came back up from the root's right side
+            i = parent(i);    // We were a left child → parent is next
+        }
+    }
+}
+
+// Preorder Traversal: Root → Left → Right
+void preorder(struct BinaryTree* tree) {
+    int n = tree->size;
+    int i = 0;
+
+    while (i < n) {
+        STAT_VISIT();
+        OUT_INT(tree->items[i], " ");
+
+        if (leftChild(i) < n) {
+            i = leftChild(i);
+            continue;
+        }
+
+        // Leaf: climb until we are a left child with a right sibling
+        while (i > 0 && !(i % 2 == 1 && i + 1 < n))
+            i = parent(i);
+        if (i == 0)
+            break;
+        i = i + 1;  // Right sibling
+    }
+}
+
+// Postorder Traversal: Left → Right → Root
+void postorder(struct BinaryTree* tree) {
+    int n = tree->size;
+    if (n == 0)
+        return;
+
+    // Start at the leftmost leaf
+    int i = 0;
+    while (leftChild(i) < n)
+        i = leftChild(i);
+
+    while (1) {
+        STAT_VISIT();
+        OUT_INT(tree->items[i], " ");
+        if (i == 0)
+            break;  // Root is always last
+
+        if (i % 2 == 1 && i + 1 < n) {
+            // Left child with a right sibling → postorder of the sibling first
+            i = i + 1;
+            while (leftChild(i) < n)
+                i = leftChild(i);
+        } else {
+            i = parent(i);
+        }
+    }
+}
+
+// Level Order Traversal: the array order itself
+void levelOrder(struct BinaryTree* tree) {
+    int i;
+    for (i = 0; i < tree->size; i++) {
+        STAT_VISIT();
+        OUT_INT(tree->items[i], " ");
+    }
+}
+
+/* ------------------- COUNT NODES ------------------------ */
+int countNodes(struct BinaryTree* tree) {
+    return tree->size;
+}
+
+// Height of the tree: a complete tree with n nodes has
+// floor(log2(n)) + 1 levels
+int treeHeight(struct BinaryTree* tree) {
+    int height = 0, n = tree->size;
+    while (n > 0) {
+        height++;
+        n /= 2;
+    }
+    return height;
+}
+
+/* -------------------- MAIN FUNCTION ---------------------
+   Menu-driven program to test all operations on the tree
+-----------------------------------------------------------*/
+int main() {
+    struct BinaryTree tree;
+    int choice, value;
+
+    createTree(&tree);
+
+    while (1) {
+        printf("\n--- ARRAY-BASED BINARY TREE OPERATIONS ---\n");
+        printf("1. Insert Node\n");
+        printf("2. Delete Node\n");
+        printf("3. Inorder Traversal\n");
+        printf("4. Preorder Traversal\n");
+        printf("5. Postorder Traversal\n");
+        printf("6. Count Nodes\n");
+        printf("8. Level Order Traversal\n");
+        printf("7. Exit\n");
+        printf("Enter your choice: ");
+        scanf("%d", &choice);
+
+        switch (choice) {
+            case 1:
+                printf("Enter value to insert: ");
+                scanf("%d", &value);
+                insertNode(&tree, value);
+                break;
+
+            case 2:
+                printf("Enter value to delete: ");
+                scanf("%d", &value);
+                deleteNode(&tree, value);
+                break;
+
+            case 3:
+                printf("Inorder Traversal: ");
+                inorder(&tree);
+                OUT_TEXT("\n");
+                OUT_FLUSH();
+                break;
+
+            case 4:
+                printf("Preorder Traversal: ");
+                preorder(&tree);
+                OUT_TEXT("\n");
+                OUT_FLUSH();
+                break;
+
+            case 5:
+                printf("Postorder Traversal: ");
+                postorder(&tree);
+                OUT_TEXT("\n");
+                OUT_FLUSH();
+                break;
+
+            case 6:
+                printf("Total number of nodes: %d\n", countNodes(&tree));
+                break;
+
+            case 7:
+                printf("Exiting program...\n");
+                STAT_HEIGHT(treeHeight(&tree));
+                STATS_DUMP();
+                free(tree.items);
+#if USE_VALUE_INDEX
+                freeIndex(&tree.index);
+#endif
+                exit(0);
+
+            // Not in 05_binaryTree.c, so it takes a new number and
+            // the shared choices (and scripted input) stay the same
+            case 8:
+                printf("Level Order Traversal: ");
+                levelOrder(&tree);
+                OUT_TEXT("\n");
+                OUT_FLUSH();
+                break;
+
+            default:
+                printf("Invalid choice! Try again.\n");
+        }
+    }
+    return 0;
+}
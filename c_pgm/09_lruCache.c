@@ -0,0 +1,350 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "instrument.h"
+#include "fastout.h"
+
+#define MAX_CAPACITY (1 << 24)  // Largest cache the table size can cover
+
+/* --------------------------- LRU CACHE ---------------------------
+   A fixed-capacity "least recently used" cache built from the two
+   pieces of 03_dll.c:
+   - a doubly linked list ordered by use: most recent at the head,
+     least recent at the tail (the next one to be evicted),
+   - a hash table from key to list node, so a key is found in O(1).
+   get, put and evict are all O(1). Every node and the hash table are
+   allocated once in createCache, so the cache never calls malloc
+   afterwards.
+------------------------------------------------------------------*/
+
+// A cache entry is a doubly linked list node with a key
+struct Node {
+    int key;
+    int value;
+    struct Node* prev;
+    struct Node* next;
+};
+
+struct LRUCache {
+    int capacity;           // Maximum number of entries
+    int size;               // Entries currently cached
+
+    struct Node* nodes;     // All 'capacity' nodes, allocated up front
+    struct Node* freeList;  // Unused nodes, linked through 'next'
+    struct Node* head;      // Most recently used
+    struct Node* tail;      // Least recently used
+
+    struct Node** table;    // Open addressing: key -> node, NULL = empty
+    unsigned tableMask;     // Table size - 1 (size is a power of two)
+    int tableShift;         // 32 - log2(table size)
+
+    // Called for every entry that leaves the cache
+    void (*onEvict)(int key, int value, void* ctx);
+    void* evictCtx;
+
+    // Counters
+    long hits;
+    long misses;
+    long evictions;         // Entries pushed out because the cache was full
+};
+
+STATS_DEFINE("lru_cache");
+
+/* ----------------------- HASH TABLE ----------------------- */
+
+// Home bucket of a key (Fibonacci hashing). Only the top bits of
+// the product depend on every bit of the key, so they are the ones
+// used; masking the low bits would send keys that are multiples of
+// a large power of two to the same few buckets.
+unsigned hashKey(struct LRUCache* cache, int key) {
+    return ((unsigned)key * 2654435769u) >> cache->tableShift;
+}
+
+// Returns the bucket holding 'key', or -1 if it is not cached
+int findBucket(struct LRUCache* cache, int key) {
+    unsigned i = hashKey(cache, key);
+
+    while (cache->table[i] != NULL) {
+        STAT_VISIT();
+        if (STAT_CMP(cache->table[i]->key == key))
+            return (int)i;
+        i = (i + 1) & cache->tableMask;
+    }
+    return -1;
+}
+
+void tableInsert(struct LRUCache* cache, struct Node* node) {
+    unsigned i = hashKey(cache, node->key);
+    while (cache->table[i] != NULL)
+        i = (i + 1) & cache->tableMask;
+    cache->table[i] = node;
+}
+
+// Empties a bucket and shifts back the entries that follow it,
+// so lookups never need tombstones
+void tableRemoveAt(struct LRUCache* cache, int bucket) {
+    unsigned mask = cache->tableMask;
+    unsigned hole = (unsigned)bucket;
+    unsigned i = (hole + 1) & mask;
+
+    while (cache->table[i] != NULL) {
+        unsigned home = hashKey(cache, cache->table[i]->key);
+        // Entry may fill the hole if its home is not in (hole, i]
+        if (((i - home) & mask) >= ((i - hole) & mask)) {
+            cache->table[hole] = cache->table[i];
+            hole = i;
+        }
+        i = (i + 1) & mask;
+    }
+    cache->table[hole] = NULL;
+}
+
+/* ----------------------- USE ORDER LIST ----------------------- */
+
+// Takes a node out of the list
+void unlinkNode(struct LRUCache* cache, struct Node* node) {
+    if (node->prev != NULL)
+        node->prev->next = node->next;
+    else
+        cache->head = node->next;
+
+    if (node->next != NULL)
+        node->next->prev = node->prev;
+    else
+        cache->tail = node->prev;
+}
+
+// Puts a node at the head (most recently used)
+void pushFront(struct LRUCache* cache, struct Node* node) {
+    node->prev = NULL;
+    node->next = cache->head;
+    if (cache->head != NULL)
+        cache->head->prev = node;
+    else
+        cache->tail = node;
+    cache->head = node;
+}
+
+/* ------------------------- CACHE API ------------------------- */
+
+// Allocates everything the cache will ever need.
+// 'capacity' must be between 1 and MAX_CAPACITY.
+void createCache(struct LRUCache* cache, int capacity,
+                 void (*onEvict)(int, int, void*), void* ctx) {
+    int i;
+    unsigned tableSize = 1;
+
+    // Keep the table at most half full
+    while (tableSize < 2u * (unsigned)capacity)
+        tableSize *= 2;
+
+    cache->capacity = capacity;
+    cache->size = 0;
+    cache->nodes = (struct Node*)malloc(capacity * sizeof(struct Node));
+    cache->table = (struct Node**)calloc(tableSize, sizeof(struct Node*));
+    STAT_ALLOC(capacity * sizeof(struct Node));
+    STAT_ALLOC(tableSize * sizeof(struct Node*));
+    cache->tableMask = tableSize - 1;
+    cache->tableShift = 32;
+    while ((1u << (32 - cache->tableShift)) < tableSize)
+        cache->tableShift--;
+    cache->head = cache->tail = NULL;
+    cache->onEvict = onEvict;
+    cache->evictCtx = ctx;
+    cache->hits = cache->misses = cache->evictions = 0;
+
+    // Chain all nodes into the free list
+    cache->freeList = NULL;
+    for (i = capacity - 1; i >= 0; i--) {
+        cache->nodes[i].next = cache->freeList;
+        cache->freeList = &cache->nodes[i];
+    }
+}
+
+void destroyCache(struct LRUCache* cache) {
+    free(cache->nodes);
+    free(cache->table);
+    STAT_FREE(cache->capacity * sizeof(struct Node));
+    STAT_FREE((cache->tableMask + 1) * sizeof(struct Node*));
+}
+
+// Removes the entry in 'bucket' and returns its node to the free list
+void removeEntry(struct LRUCache* cache, int bucket) {
+    struct Node* node = cache->table[bucket];
+
+    tableRemoveAt(cache, bucket);
+    unlinkNode(cache, node);
+    cache->size--;
+
+    if (cache->onEvict != NULL)
+        cache->onEvict(node->key, node->value, cache->evictCtx);
+
+    node->next = cache->freeList;
+    cache->freeList = node;
+}
+
+// Looks up a key. On a hit stores the value in *value, marks the
+// entry as most recently used and returns 1. Returns 0 on a miss.
+int cacheGet(struct LRUCache* cache, int key, int* value) {
+    int bucket = findBucket(cache, key);
+
+    if (bucket == -1) {
+        cache->misses++;
+        return 0;
+    }
+
+    struct Node* node = cache->table[bucket];
+    unlinkNode(cache, node);
+    pushFront(cache, node);
+
+    cache->hits++;
+    *value = node->value;
+    return 1;
+}
+
+// Inserts or updates a key. If the cache is full, the least recently
+// used entry is evicted first.
+void cachePut(struct LRUCache* cache, int key, int value) {
+    if (cache->capacity <= 0)
+        return;
+
+    int bucket = findBucket(cache, key);
+
+    // Key already cached: update it and mark it as used
+    if (bucket != -1) {
+        struct Node* node = cache->table[bucket];
+        node->value = value;
+        unlinkNode(cache, node);
+        pushFront(cache, node);
+        return;
+    }
+
+    // Full: evict the tail
+    if (cache->size == cache->capacity) {
+        removeEntry(cache, findBucket(cache, cache->tail->key));
+        cache->evictions++;
+    }
+
+    struct Node* node = cache->freeList;
+    cache->freeList = node->next;
+
+    node->key = key;
+    node->value = value;
+    pushFront(cache, node);
+    tableInsert(cache, node);
+    cache->size++;
+}
+
+// Removes a key from the cache. Returns 1 if it was cached.
+int cacheEvict(struct LRUCache* cache, int key) {
+    int bucket = findBucket(cache, key);
+
+    if (bucket == -1)
+        return 0;
+
+    removeEntry(cache, bucket);
+    return 1;
+}
+
+// Shows entries from most to least recently used
+void displayCache(struct LRUCache* cache) {
+    if (cache->head == NULL) {
+        printf("Cache is empty.\n");
+        return;
+    }
+
+    printf("Cache (most → least recently used): ");
+    struct Node* temp = cache->head;
+    while (temp != NULL) {
+        STAT_VISIT();
+        OUT_TEXT("[");
+        OUT_INT(temp->key, ": ");
+        OUT_INT(temp->value, "] ");
+        temp = temp->next;
+    }
+    OUT_TEXT("\n");
+    OUT_FLUSH();
+}
+
+void displayCounters(struct LRUCache* cache) {
+    long lookups = cache->hits + cache->misses;
+
+    printf("Size: %d / %d\n", cache->size, cache->capacity);
+    printf("Hits: %ld  Misses: %ld  Evictions: %ld\n",
+           cache->hits, cache->misses, cache->evictions);
+    if (lookups > 0)
+        printf("Hit ratio: %.2f%%\n", 100.0 * cache->hits / lookups);
+}
+
+// Example eviction callback
+void printEviction(int key, int value, void* ctx) {
+    (void)ctx;
+    printf("Evicted key %d (value %d).\n", key, value);
+}
+
+// MAIN FUNCTION — Menu-driven program
+int main() {
+    struct LRUCache cache;
+    int choice, key, value, capacity;
+
+    printf("Enter cache capacity: ");
+    if (scanf("%d", &capacity) != 1 || capacity < 1 || capacity > MAX_CAPACITY) {
+        printf("Capacity must be between 1 and %d.\n", MAX_CAPACITY);
+        return 1;
+    }
+    createCache(&cache, capacity, printEviction, NULL);
+
+    while (1) {
+        printf("\n--- LRU CACHE OPERATIONS ---\n");
+        printf("1. Put (Insert / Update)\n");
+        printf("2. Get\n");
+        printf("3. Evict Key\n");
+        printf("4. Display Cache\n");
+        printf("5. Show Counters\n");
+        printf("6. Exit\n");
+        printf("Enter your choice: ");
+        scanf("%d", &choice);
+
+        switch (choice) {
+            case 1:
+                printf("Enter key and value: ");
+                scanf("%d %d", &key, &value);
+                cachePut(&cache, key, value);
+                break;
+
+            case 2:
+                printf("Enter key: ");
+                scanf("%d", &key);
+                if (cacheGet(&cache, key, &value))
+                    printf("Hit: key %d has value %d.\n", key, value);
+                else
+                    printf("Miss: key %d is not cached.\n", key);
+                break;
+
+            case 3:
+                printf("Enter key: ");
+                scanf("%d", &key);
+                if (!cacheEvict(&cache, key))
+                    printf("Key %d is not cached.\n", key);
+                break;
+
+            case 4:
+                displayCache(&cache);
+                break;
+
+            case 5:
+                displayCounters(&cache);
+                break;
+
+            case 6:
+                printf("Exiting program...\n");
+                destroyCache(&cache);
+                STATS_DUMP();
+                exit(0);
+
+            default:
+                printf("Invalid choice! Try again.\n");
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,462 @@
+#define _DEFAULT_SOURCE  // clock_gettime also under -std=c11
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <time.h>
+#include "instrument.h"
+#include "fastout.h"
+
+/* ------------------------ XOR LINKED LIST ------------------------
+   A doubly linked list that stores ONE link per node instead of two:
+       link = address(prev) XOR address(next)
+   Walking from either end works because the node we came from is
+   known: next = prev XOR link. On a 64-bit machine a node shrinks
+   from 24 bytes (int + two pointers + padding) to 16 bytes.
+   The operations are those of 03_dll.c and choices 1-10 keep its
+   menu numbers (there is no sort or merge here); 11 is a benchmark.
+------------------------------------------------------------------*/
+
+#define POOL_BLOCK 1024  // Nodes allocated at a time by the node pool
+
+struct Node {
+    int data;
+    uintptr_t link;  // address(prev) ^ address(next)
+};
+
+STATS_DEFINE("xor_linked_list");
+
+/* ------------------------- NODE POOL -------------------------
+   malloc rounds every small request up to the same minimum chunk,
+   so a smaller node only saves memory if nodes are carved out of
+   larger blocks. Freed nodes go on a free list and are reused.
+--------------------------------------------------------------*/
+struct PoolBlock {
+    struct PoolBlock* next;
+};
+
+struct NodePool {
+    size_t nodeSize;           // Size of one node in bytes
+    struct PoolBlock* blocks;  // All blocks, to free them at the end
+    char* nextFree;            // Next never-used node in the newest block
+    char* blockEnd;            // End of the newest block
+    void* freeList;            // Freed nodes, linked through their first word
+    long blockCount;
+};
+
+void createPool(struct NodePool* pool, size_t nodeSize) {
+    pool->nodeSize = nodeSize;
+    pool->blocks = NULL;
+    pool->nextFree = pool->blockEnd = NULL;
+    pool->freeList = NULL;
+    pool->blockCount = 0;
+}
+
+// Block header size, rounded up so the nodes stay 16-byte aligned
+size_t blockHeader() {
+    return (sizeof(struct PoolBlock) + 15) & ~(size_t)15;
+}
+
+void* poolAlloc(struct NodePool* pool) {
+    // Reuse a freed node first
+    if (pool->freeList != NULL) {
+        void* node = pool->freeList;
+        pool->freeList = *(void**)node;
+        return node;
+    }
+
+    // Start a new block when the current one is used up
+    if (pool->nextFree == pool->blockEnd) {
+        size_t header = blockHeader();
+        struct PoolBlock* block = (struct PoolBlock*)malloc(header + POOL_BLOCK * pool->nodeSize);
+        STAT_ALLOC(header + POOL_BLOCK * pool->nodeSize);
+        block->next = pool->blocks;
+        pool->blocks = block;
+        pool->nextFree = (char*)block + header;
+        pool->blockEnd = pool->nextFree + POOL_BLOCK * pool->nodeSize;
+        pool->blockCount++;
+    }
+
+    void* node = pool->nextFree;
+    pool->nextFree += pool->nodeSize;
+    return node;
+}
+
+void poolFree(struct NodePool* pool, void* node) {
+    *(void**)node = pool->freeList;
+    pool->freeList = node;
+}
+
+void destroyPool(struct NodePool* pool) {
+    while (pool->blocks != NULL) {
+        struct PoolBlock* next = pool->blocks->next;
+        free(pool->blocks);
+        STAT_FREE(blockHeader() + POOL_BLOCK * pool->nodeSize);
+        pool->blocks = next;
+    }
+    createPool(pool, pool->nodeSize);
+}
+
+/* ----------------------- XOR LIST ----------------------- */
+
+// List handle (same shape as in 03_dll.c)
+struct List {
+    struct Node* head;
+    struct Node* tail;
+    int size;
+    struct NodePool pool;
+};
+
+// XOR of two node addresses
+struct Node* XOR(struct Node* a, struct Node* b) {
+    return (struct Node*)((uintptr_t)a ^ (uintptr_t)b);
+}
+
+// Function to initialize an empty list
+void createList(struct List* list) {
+    list->head = NULL;
+    list->tail = NULL;
+    list->size = 0;
+    createPool(&list->pool, sizeof(struct Node));
+}
+
+// Function to create a new node with a given value
+struct Node* createNode(struct List* list, int value) {
+    struct Node* newNode = (struct Node*)poolAlloc(&list->pool);
+    newNode->data = value;
+    newNode->link = 0;
+    return newNode;
+}
+
+// Links a new node before 'end', which is the head or the tail.
+// Inserting at either end is the same operation seen from the other side.
+void insertAtEdge(struct List* list, struct Node** end, struct Node** otherEnd, int value) {
+    struct Node* newNode = createNode(list, value);
+
+    // New node's neighbours: NULL on the outside, old end on the inside
+    newNode->link = (uintptr_t)*end;
+
+    if (*end == NULL)
+        *otherEnd = newNode;  // List was empty
+    else
+        (*end)->link ^= (uintptr_t)newNode;  // Old end gains a neighbour
+
+    *end = newNode;
+    list->size++;
+}
+
+// Unlinks and frees the node at 'end' (head or tail); returns its value
+int deleteAtEdge(struct List* list, struct Node** end, struct Node** otherEnd) {
+    struct Node* temp = *end;
+    struct Node* inner = XOR(NULL, (struct Node*)temp->link);  // Its only neighbour
+    int value = temp->data;
+
+    if (inner == NULL)
+        *otherEnd = NULL;  // List becomes empty
+    else
+        inner->link ^= (uintptr_t)temp;  // Forget the removed neighbour
+
+    *end = inner;
+    list->size--;
+    poolFree(&list->pool, temp);
+    return value;
+}
+
+// Function to insert a node at the beginning of the list
+void insertAtBeginning(struct List* list, int value) {
+    insertAtEdge(list, &list->head, &list->tail, value);
+    printf("Node inserted at beginning.\n");
+}
+
+// Function to insert a node at the end of the list
+void insertAtEnd(struct List* list, int value) {
+    insertAtEdge(list, &list->tail, &list->head, value);
+    printf("Node inserted at end.\n");
+}
+
+// Function to delete a node from the beginning
+void deleteFromBeginning(struct List* list) {
+    if (list->head == NULL) {
+        printf("List is empty. Cannot delete.\n");
+        return;
+    }
+    int value = deleteAtEdge(list, &list->head, &list->tail);
+    printf("Node with value %d deleted from beginning.\n", value);
+}
+
+// Function to delete a node from the end
+void deleteFromEnd(struct List* list) {
+    if (list->tail == NULL) {
+        printf("List is empty. Cannot delete.\n");
+        return;
+    }
+    int value = deleteAtEdge(list, &list->tail, &list->head);
+    printf("Node with value %d deleted from end.\n", value);
+}
+
+// Function to delete the first node with a given value
+void deleteByValue(struct List* list, int value) {
+    struct Node* prev = NULL;
+    struct Node* temp = list->head;
+
+    // Walk forward remembering the previous node
+    while (temp != NULL && STAT_CMP(temp->data != value)) {
+        STAT_VISIT();
+        struct Node* next = XOR(prev, (struct Node*)temp->link);
+        prev = temp;
+        temp = next;
+    }
+
+    if (temp == NULL) {
+        printf("Value not found.\n");
+        return;
+    }
+
+    struct Node* next = XOR(prev, (struct Node*)temp->link);
+
+    // In each neighbour, replace 'temp' by the node on its other side
+    if (prev != NULL)
+        prev->link ^= (uintptr_t)temp ^ (uintptr_t)next;
+    else
+        list->head = next;
+
+    if (next != NULL)
+        next->link ^= (uintptr_t)temp ^ (uintptr_t)prev;
+    else
+        list->tail = prev;
+
+    list->size--;
+    poolFree(&list->pool, temp);
+    printf("Node with value %d deleted.\n", value);
+}
+
+// Prints every value starting from one end
+void traverseFrom(struct Node* start) {
+    struct Node* prev = NULL;
+    struct Node* temp = start;
+
+    while (temp != NULL) {
+        STAT_VISIT();
+        OUT_INT(temp->data, " ");
+        struct Node* next = XOR(prev, (struct Node*)temp->link);
+        prev = temp;
+        temp = next;
+    }
+    OUT_TEXT("\n");
+    OUT_FLUSH();
+}
+
+// Function to traverse and display the list from beginning to end
+void traverseFromBeginning(struct List* list) {
+    if (list->head == NULL) {
+        printf("List is empty.\n");
+        return;
+    }
+    printf("Traversal from beginning: ");
+    traverseFrom(list->head);
+}
+
+// Function to traverse and display the list from end to beginning
+void traverseFromEnd(struct List* list) {
+    if (list->tail == NULL) {
+        printf("List is empty.\n");
+        return;
+    }
+    printf("Traversal from end: ");
+    traverseFrom(list->tail);
+}
+
+// Function to display both traversals
+void displayBothSides(struct List* list) {
+    traverseFromBeginning(list);
+    traverseFromEnd(list);
+}
+
+// Function to count how many nodes are in the list
+int countNodes(struct List* list) {
+    return list->size;
+}
+
+void destroyList(struct List* list) {
+    destroyPool(&list->pool);
+    list->head = list->tail = NULL;
+    list->size = 0;
+}
+
+/* ------------------------ BENCHMARK ------------------------
+   Runs the same workload on the XOR list and on an ordinary
+   doubly linked list (two pointers per node, same node pool):
+   fill from both ends, walk forward and backward, empty it.
+------------------------------------------------------------*/
+
+struct DNode {
+    int data;
+    struct DNode* prev;
+    struct DNode* next;
+};
+
+double nowSeconds() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+void benchmarkDLL(int n) {
+    struct NodePool pool;
+    struct DNode *head = NULL, *tail = NULL, *temp;
+    long long sum = 0;
+    int i;
+
+    createPool(&pool, sizeof(struct DNode));
+    double start = nowSeconds();
+
+    for (i = 0; i < n; i++) {
+        struct DNode* node = (struct DNode*)poolAlloc(&pool);
+        node->data = i;
+        if (i % 2 == 0) {            // Even values at the front
+            node->prev = NULL;
+            node->next = head;
+            if (head) head->prev = node; else tail = node;
+            head = node;
+        } else {                     // Odd values at the back
+            node->next = NULL;
+            node->prev = tail;
+            if (tail) tail->next = node; else head = node;
+            tail = node;
+        }
+    }
+    for (temp = head; temp != NULL; temp = temp->next)
+        sum += temp->data;
+    for (temp = tail; temp != NULL; temp = temp->prev)
+        sum -= temp->data;
+    while (head != NULL) {
+        temp = head;
+        head = head->next;
+        poolFree(&pool, temp);
+    }
+
+    double elapsed = nowSeconds() - start;
+    printf("Doubly linked list: %2zu bytes/node, %8.2f MB for %d nodes, %8.2f ms (check %lld)\n",
+           sizeof(struct DNode), n * (double)sizeof(struct DNode) / (1 << 20), n, elapsed * 1e3, sum);
+    destroyPool(&pool);
+}
+
+void benchmarkXOR(int n) {
+    struct List list;
+    struct Node *prev, *temp, *next;
+    long long sum = 0;
+    int i;
+
+    createList(&list);
+    double start = nowSeconds();
+
+    for (i = 0; i < n; i++) {
+        if (i % 2 == 0)
+            insertAtEdge(&list, &list.head, &list.tail, i);
+        else
+            insertAtEdge(&list, &list.tail, &list.head, i);
+    }
+    for (prev = NULL, temp = list.head; temp != NULL; prev = temp, temp = next) {
+        sum += temp->data;
+        next = XOR(prev, (struct Node*)temp->link);
+    }
+    for (prev = NULL, temp = list.tail; temp != NULL; prev = temp, temp = next) {
+        sum -= temp->data;
+        next = XOR(prev, (struct Node*)temp->link);
+    }
+    while (list.head != NULL)
+        deleteAtEdge(&list, &list.head, &list.tail);
+
+    double elapsed = nowSeconds() - start;
+    printf("XOR linked list:    %2zu bytes/node, %8.2f MB for %d nodes, %8.2f ms (check %lld)\n",
+           sizeof(struct Node), n * (double)sizeof(struct Node) / (1 << 20), n, elapsed * 1e3, sum);
+    destroyList(&list);
+}
+
+// MAIN FUNCTION — Menu-driven program
+int main() {
+    struct List list;
+    int choice, value;
+
+    createList(&list);
+
+    while (1) {
+        printf("\n--- XOR LINKED LIST OPERATIONS ---\n");
+        printf("1. Insert at Beginning\n");
+        printf("2. Insert at End\n");
+        printf("3. Delete from Beginning\n");
+        printf("4. Delete from End\n");
+        printf("5. Traverse from Beginning\n");
+        printf("6. Traverse from End\n");
+        printf("7. Display from Both Sides\n");
+        printf("8. Count Number of Nodes\n");
+        printf("10. Delete by Value\n");
+        printf("11. Benchmark against Doubly Linked List\n");
+        printf("9. Exit\n");
+        printf("Enter your choice: ");
+        scanf("%d", &choice);
+
+        switch (choice) {
+            case 1:
+                printf("Enter value to insert: ");
+                scanf("%d", &value);
+                insertAtBeginning(&list, value);
+                break;
+
+            case 2:
+                printf("Enter value to insert: ");
+                scanf("%d", &value);
+                insertAtEnd(&list, value);
+                break;
+
+            case 3:
+                deleteFromBeginning(&list);
+                break;
+
+            case 4:
+                deleteFromEnd(&list);
+                break;
+
+            case 5:
+                traverseFromBeginning(&list);
+                break;
+
+            case 6:
+                traverseFromEnd(&list);
+                break;
+
+            case 7:
+                displayBothSides(&list);
+                break;
+
+            case 8:
+                printf("Total number of nodes: %d\n", countNodes(&list));
+                break;
+
+            case 9:
+                printf("Exiting program...\n");
+                destroyList(&list);
+                STATS_DUMP();
+                exit(0);
+
+            // Delete by Value is 10 in 03_dll.c as well; the benchmark
+            // has no counterpart there
+            case 10:
+                printf("Enter value to delete: ");
+                scanf("%d", &value);
+                deleteByValue(&list, value);
+                break;
+
+            case 11:
+                printf("Enter number of nodes: ");
+                scanf("%d", &value);
+                benchmarkDLL(value);
+                benchmarkXOR(value);
+                break;
+
+            default:
+                printf("Invalid choice! Please try again.\n");
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,607 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+/* --------------------- INDEX-LINKED NODES ---------------------
+   In 01_sll.c, 03_dll.c and the tree programs every link is a
+   64-bit pointer next to a 32-bit int, so most of a node is link
+   and padding. Here each kind of node lives in one contiguous
+   array (an "arena") and links are 32-bit indices into it:
+
+       node          pointer version   index version
+       SLL node            16 bytes         8 bytes
+       DLL node            24 bytes        12 bytes
+       tree node           24 bytes        12 bytes
+
+   Index 0 is never used, so 0 plays the role of NULL. Since links
+   are offsets and not addresses, the arrays may be moved by
+   realloc, and a whole structure is saved or copied with one
+   memcpy / fwrite.
+----------------------------------------------------------------*/
+
+#define NIL 0                 // "NULL" index
+#define INITIAL_CAPACITY 16   // Starting number of slots in an arena
+#define MAX_SLOTS (1u << 30)  // Largest arena a file may describe
+
+struct SllNode {
+    int data;
+    uint32_t next;
+};
+
+struct DllNode {
+    int data;
+    uint32_t prev;
+    uint32_t next;
+};
+
+struct TreeNode {
+    int data;
+    uint32_t left;
+    uint32_t right;
+};
+
+// A growable array of equally sized nodes with a free list.
+// A free slot keeps the index of the next free slot in its first
+// 4 bytes (the 'data' field of every node type).
+struct Arena {
+    char* base;          // Slot i is at base + i * nodeSize
+    uint32_t nodeSize;
+    uint32_t used;       // Slots ever handed out (slot 0 included)
+    uint32_t capacity;
+    uint32_t freeHead;   // First free slot, NIL if none
+    uint32_t live;       // Slots currently in use
+};
+
+// Everything the menu works on: three arenas and their roots
+struct Structures {
+    struct Arena sllArena;
+    struct Arena dllArena;
+    struct Arena treeArena;
+    uint32_t sllHead;
+    uint32_t dllHead, dllTail;
+    uint32_t treeRoot;
+};
+
+// Access a slot as a specific node type
+#define SLL(s, i)  (((struct SllNode*)(s)->sllArena.base) + (i))
+#define DLL(s, i)  (((struct DllNode*)(s)->dllArena.base) + (i))
+#define TREE(s, i) (((struct TreeNode*)(s)->treeArena.base) + (i))
+
+/* -------------------------- ARENA -------------------------- */
+
+void createArena(struct Arena* arena, uint32_t nodeSize) {
+    arena->nodeSize = nodeSize;
+    arena->capacity = INITIAL_CAPACITY;
+    arena->base = (char*)calloc(arena->capacity, nodeSize);
+    arena->used = 1;  // Slot 0 is reserved for NIL
+    arena->freeHead = NIL;
+    arena->live = 0;
+}
+
+// Returns the index of a zeroed slot. May move arena->base, so
+// pointers into the arena must be re-read after calling it.
+uint32_t arenaAlloc(struct Arena* arena) {
+    uint32_t index;
+
+    if (arena->freeHead != NIL) {
+        index = arena->freeHead;
+        memcpy(&arena->freeHead, arena->base + (size_t)index * arena->nodeSize, sizeof(uint32_t));
+    } else {
+        if (arena->used == arena->capacity) {
+            arena->capacity *= 2;
+            arena->base = (char*)realloc(arena->base, (size_t)arena->capacity * arena->nodeSize);
+        }
+        index = arena->used++;
+    }
+
+    memset(arena->base + (size_t)index * arena->nodeSize, 0, arena->nodeSize);
+    arena->live++;
+    return index;
+}
+
+void arenaFree(struct Arena* arena, uint32_t index) {
+    memcpy(arena->base + (size_t)index * arena->nodeSize, &arena->freeHead, sizeof(uint32_t));
+    arena->freeHead = index;
+    arena->live--;
+}
+
+void destroyArena(struct Arena* arena) {
+    free(arena->base);
+    arena->base = NULL;
+}
+
+void createStructures(struct Structures* s) {
+    createArena(&s->sllArena, sizeof(struct SllNode));
+    createArena(&s->dllArena, sizeof(struct DllNode));
+    createArena(&s->treeArena, sizeof(struct TreeNode));
+    s->sllHead = NIL;
+    s->dllHead = s->dllTail = NIL;
+    s->treeRoot = NIL;
+}
+
+void destroyStructures(struct Structures* s) {
+    destroyArena(&s->sllArena);
+    destroyArena(&s->dllArena);
+    destroyArena(&s->treeArena);
+}
+
+/* ----------------------- SINGLY LINKED ----------------------- */
+
+// Function to insert a new node at the beginning of the list
+void sllInsertAtBeginning(struct Structures* s, int value) {
+    uint32_t node = arenaAlloc(&s->sllArena);
+    SLL(s, node)->data = value;
+    SLL(s, node)->next = s->sllHead;
+    s->sllHead = node;
+    printf("Node inserted at beginning.\n");
+}
+
+// Function to delete the first node with a given value
+void sllDeleteByValue(struct Structures* s, int value) {
+    uint32_t temp = s->sllHead, prev = NIL;
+
+    while (temp != NIL && SLL(s, temp)->data != value) {
+        prev = temp;
+        temp = SLL(s, temp)->next;
+    }
+
+    if (temp == NIL) {
+        printf("Value not found.\n");
+        return;
+    }
+
+    if (prev == NIL)
+        s->sllHead = SLL(s, temp)->next;
+    else
+        SLL(s, prev)->next = SLL(s, temp)->next;
+
+    arenaFree(&s->sllArena, temp);
+    printf("Node with value %d deleted.\n", value);
+}
+
+void sllDisplay(struct Structures* s) {
+    uint32_t temp = s->sllHead;
+
+    if (temp == NIL) {
+        printf("List is empty.\n");
+        return;
+    }
+
+    printf("Linked List: ");
+    while (temp != NIL) {
+        printf("%d -> ", SLL(s, temp)->data);
+        temp = SLL(s, temp)->next;
+    }
+    printf("NULL\n");
+}
+
+/* ----------------------- DOUBLY LINKED ----------------------- */
+
+// Function to insert a node at the end of the list
+void dllInsertAtEnd(struct Structures* s, int value) {
+    uint32_t node = arenaAlloc(&s->dllArena);
+    DLL(s, node)->data = value;
+    DLL(s, node)->prev = s->dllTail;
+
+    if (s->dllTail == NIL)
+        s->dllHead = node;
+    else
+        DLL(s, s->dllTail)->next = node;
+    s->dllTail = node;
+
+    printf("Node inserted at end.\n");
+}
+
+// Function to delete a node from the beginning
+void dllDeleteFromBeginning(struct Structures* s) {
+    uint32_t temp = s->dllHead;
+
+    if (temp == NIL) {
+        printf("List is empty. Cannot delete.\n");
+        return;
+    }
+
+    s->dllHead = DLL(s, temp)->next;
+    if (s->dllHead != NIL)
+        DLL(s, s->dllHead)->prev = NIL;
+    else
+        s->dllTail = NIL;
+
+    printf("Node with value %d deleted from beginning.\n", DLL(s, temp)->data);
+    arenaFree(&s->dllArena, temp);
+}
+
+// Function to display both traversals
+void dllDisplayBothSides(struct Structures* s) {
+    uint32_t temp;
+
+    if (s->dllHead == NIL) {
+        printf("List is empty.\n");
+        return;
+    }
+
+    printf("Traversal from beginning: ");
+    for (temp = s->dllHead; temp != NIL; temp = DLL(s, temp)->next)
+        printf("%d ", DLL(s, temp)->data);
+    printf("\nTraversal from end: ");
+    for (temp = s->dllTail; temp != NIL; temp = DLL(s, temp)->prev)
+        printf("%d ", DLL(s, temp)->data);
+    printf("\n");
+}
+
+/* ---------------------- BINARY SEARCH TREE ---------------------- */
+
+// Inserts a value following BST rules (duplicates are ignored).
+// arenaAlloc may move the array, so the parent is re-read by index
+// after the allocation instead of keeping a pointer to its link.
+void treeInsert(struct Structures* s, int value) {
+    uint32_t parent = NIL, temp = s->treeRoot;
+
+    while (temp != NIL) {
+        parent = temp;
+        if (value < TREE(s, temp)->data)
+            temp = TREE(s, temp)->left;
+        else if (value > TREE(s, temp)->data)
+            temp = TREE(s, temp)->right;
+        else {
+            printf("Duplicate value! Ignored.\n");
+            return;
+        }
+    }
+
+    uint32_t node = arenaAlloc(&s->treeArena);
+    TREE(s, node)->data = value;
+
+    if (parent == NIL)
+        s->treeRoot = node;
+    else if (value < TREE(s, parent)->data)
+        TREE(s, parent)->left = node;
+    else
+        TREE(s, parent)->right = node;
+}
+
+int treeSearch(struct Structures* s, int value) {
+    uint32_t temp = s->treeRoot;
+
+    while (temp != NIL && TREE(s, temp)->data != value)
+        temp = (value < TREE(s, temp)->data) ? TREE(s, temp)->left : TREE(s, temp)->right;
+
+    return temp != NIL;
+}
+
+// Inorder Traversal (Left → Root → Right)
+void treeInorder(struct Structures* s, uint32_t root) {
+    if (root == NIL)
+        return;
+    treeInorder(s, TREE(s, root)->left);
+    printf("%d ", TREE(s, root)->data);
+    treeInorder(s, TREE(s, root)->right);
+}
+
+/* ------------------- MEMORY AND SERIALIZATION ------------------- */
+
+void showArena(const char* name, struct Arena* arena) {
+    printf("%-6s %2u bytes/node, %u live nodes, %u slots, %zu bytes allocated\n",
+           name, arena->nodeSize, arena->live, arena->used - 1,
+           (size_t)arena->capacity * arena->nodeSize);
+}
+
+void showMemory(struct Structures* s) {
+    showArena("SLL:", &s->sllArena);
+    showArena("DLL:", &s->dllArena);
+    showArena("Tree:", &s->treeArena);
+    printf("(Pointer-linked nodes need %zu / %zu / %zu bytes each.)\n",
+           sizeof(struct { int data; void* next; }),
+           sizeof(struct { int data; void* prev; void* next; }),
+           sizeof(struct { int data; void* left; void* right; }));
+}
+
+// Writes the used part of an arena as one block
+int writeArena(FILE* f, struct Arena* arena) {
+    return fwrite(&arena->nodeSize, sizeof(uint32_t), 1, f) == 1
+        && fwrite(&arena->used, sizeof(uint32_t), 1, f) == 1
+        && fwrite(&arena->freeHead, sizeof(uint32_t), 1, f) == 1
+        && fwrite(&arena->live, sizeof(uint32_t), 1, f) == 1
+        && fwrite(arena->base, arena->nodeSize, arena->used, f) == arena->used;
+}
+
+// Bytes left in the file after the current position
+long bytesLeft(FILE* f) {
+    long here = ftell(f), end;
+
+    fseek(f, 0, SEEK_END);
+    end = ftell(f);
+    fseek(f, here, SEEK_SET);
+    return end - here;
+}
+
+// Reads an arena written by writeArena. Only the sizes are checked
+// here; the links inside are checked by validateStructures.
+int readArena(FILE* f, struct Arena* arena) {
+    uint32_t nodeSize = arena->nodeSize, used;
+
+    if (fread(&arena->nodeSize, sizeof(uint32_t), 1, f) != 1 || arena->nodeSize != nodeSize
+        || fread(&used, sizeof(uint32_t), 1, f) != 1 || used == 0 || used > MAX_SLOTS
+        || fread(&arena->freeHead, sizeof(uint32_t), 1, f) != 1
+        || fread(&arena->live, sizeof(uint32_t), 1, f) != 1 || arena->live >= used
+        || (uint64_t)used * nodeSize > (uint64_t)bytesLeft(f))
+        return 0;
+
+    uint32_t capacity = INITIAL_CAPACITY;
+    while (capacity < used)
+        capacity *= 2;
+    char* base = (char*)realloc(arena->base, (size_t)capacity * nodeSize);
+    if (base == NULL)
+        return 0;
+
+    arena->base = base;
+    arena->capacity = capacity;
+    arena->used = used;
+    return fread(arena->base, nodeSize, used, f) == used;
+}
+
+/* A loaded file is only used if every slot of every arena is reached
+   exactly once: from its structure's root if it is live, or from
+   the arena's free list if it is free. Out-of-range indices, cycles,
+   shared nodes and wrong counts are all rejected this way, so a
+   damaged or crafted file cannot send a later walk outside the
+   array or around a loop. */
+
+// Marks a slot as reached. Returns 0 if the index is out of range or
+// the slot was reached before.
+int markSlot(const struct Arena* arena, char* seen, uint32_t index) {
+    if (index == NIL || index >= arena->used || seen[index])
+        return 0;
+    seen[index] = 1;
+    return 1;
+}
+
+int checkSll(struct Structures* s, char* seen) {
+    uint32_t temp;
+
+    for (temp = s->sllHead; temp != NIL; temp = SLL(s, temp)->next)
+        if (!markSlot(&s->sllArena, seen, temp))
+            return 0;
+    return 1;
+}
+
+// The prev links must mirror the next links, ending at the tail
+int checkDll(struct Structures* s, char* seen) {
+    uint32_t temp, prev = NIL;
+
+    for (temp = s->dllHead; temp != NIL; temp = DLL(s, temp)->next) {
+        if (!markSlot(&s->dllArena, seen, temp) || DLL(s, temp)->prev != prev)
+            return 0;
+        prev = temp;
+    }
+    return s->dllTail == prev;
+}
+
+// Walks the tree in order with an explicit stack (every slot is
+// pushed at most once) and checks the values are strictly increasing
+int checkTree(struct Structures* s, char* seen) {
+    uint32_t* stack = (uint32_t*)malloc((size_t)s->treeArena.used * sizeof(uint32_t));
+    uint32_t node = s->treeRoot, size = 0;
+    int first = 1, last = 0;
+
+    while (node != NIL || size > 0) {
+        while (node != NIL) {
+            if (!markSlot(&s->treeArena, seen, node)) {
+                free(stack);
+                return 0;
+            }
+            stack[size++] = node;
+            node = TREE(s, node)->left;
+        }
+
+        node = stack[--size];
+        if (!first && TREE(s, node)->data <= last) {
+            free(stack);
+            return 0;
+        }
+        first = 0;
+        last = TREE(s, node)->data;
+        node = TREE(s, node)->right;
+    }
+
+    free(stack);
+    return 1;
+}
+
+// After the structure walk: the live count must match, and the free
+// list must cover exactly the slots that are left
+int checkFreeList(const struct Arena* arena, char* seen) {
+    uint32_t index, live = 0;
+
+    for (index = 1; index < arena->used; index++)
+        live += seen[index];
+    if (live != arena->live)
+        return 0;
+
+    for (index = arena->freeHead; index != NIL; ) {
+        if (!markSlot(arena, seen, index))
+            return 0;
+        memcpy(&index, arena->base + (size_t)index * arena->nodeSize, sizeof(uint32_t));
+    }
+
+    for (index = 1; index < arena->used; index++)
+        if (!seen[index])
+            return 0;
+    return 1;
+}
+
+int validateStructures(struct Structures* s) {
+    char* sllSeen = (char*)calloc(s->sllArena.used, 1);
+    char* dllSeen = (char*)calloc(s->dllArena.used, 1);
+    char* treeSeen = (char*)calloc(s->treeArena.used, 1);
+
+    int ok = checkSll(s, sllSeen) && checkFreeList(&s->sllArena, sllSeen)
+          && checkDll(s, dllSeen) && checkFreeList(&s->dllArena, dllSeen)
+          && checkTree(s, treeSeen) && checkFreeList(&s->treeArena, treeSeen);
+
+    free(sllSeen);
+    free(dllSeen);
+    free(treeSeen);
+    return ok;
+}
+
+// Saves all three structures: one fwrite per arena, no per-node work
+void saveStructures(struct Structures* s, const char* path) {
+    FILE* f = fopen(path, "wb");
+
+    if (f == NULL) {
+        printf("Cannot open %s for writing.\n", path);
+        return;
+    }
+
+    int ok = fwrite(&s->sllHead, sizeof(uint32_t), 1, f) == 1
+          && fwrite(&s->dllHead, sizeof(uint32_t), 1, f) == 1
+          && fwrite(&s->dllTail, sizeof(uint32_t), 1, f) == 1
+          && fwrite(&s->treeRoot, sizeof(uint32_t), 1, f) == 1
+          && writeArena(f, &s->sllArena)
+          && writeArena(f, &s->dllArena)
+          && writeArena(f, &s->treeArena);
+
+    fclose(f);
+    printf(ok ? "Saved to %s.\n" : "Error while writing %s.\n", path);
+}
+
+// Replaces the current structures with the ones stored in 'path'
+void loadStructures(struct Structures* s, const char* path) {
+    FILE* f = fopen(path, "rb");
+    struct Structures loaded;
+
+    if (f == NULL) {
+        printf("Cannot open %s for reading.\n", path);
+        return;
+    }
+
+    createStructures(&loaded);
+    int ok = fread(&loaded.sllHead, sizeof(uint32_t), 1, f) == 1
+          && fread(&loaded.dllHead, sizeof(uint32_t), 1, f) == 1
+          && fread(&loaded.dllTail, sizeof(uint32_t), 1, f) == 1
+          && fread(&loaded.treeRoot, sizeof(uint32_t), 1, f) == 1
+          && readArena(f, &loaded.sllArena)
+          && readArena(f, &loaded.dllArena)
+          && readArena(f, &loaded.treeArena)
+          && validateStructures(&loaded);
+    fclose(f);
+
+    if (!ok) {
+        printf("%s is not a valid file.\n", path);
+        destroyStructures(&loaded);
+        return;
+    }
+
+    destroyStructures(s);
+    *s = loaded;
+    printf("Loaded from %s.\n", path);
+}
+
+// MAIN FUNCTION — Menu-driven program
+int main() {
+    struct Structures s;
+    int choice, value;
+    char path[256];
+
+    createStructures(&s);
+
+    while (1) {
+        printf("\n--- INDEX-LINKED (32-BIT) STRUCTURES ---\n");
+        printf("1. SLL: Insert at Beginning\n");
+        printf("2. SLL: Delete by Value\n");
+        printf("3. SLL: Display List\n");
+        printf("4. DLL: Insert at End\n");
+        printf("5. DLL: Delete from Beginning\n");
+        printf("6. DLL: Display from Both Sides\n");
+        printf("7. BST: Insert Node\n");
+        printf("8. BST: Search Node\n");
+        printf("9. BST: Inorder Traversal\n");
+        printf("10. Show Memory Usage\n");
+        printf("11. Save to File\n");
+        printf("12. Load from File\n");
+        printf("13. Exit\n");
+        printf("Enter your choice: ");
+        scanf("%d", &choice);
+
+        switch (choice) {
+            case 1:
+                printf("Enter value to insert: ");
+                scanf("%d", &value);
+                sllInsertAtBeginning(&s, value);
+                break;
+
+            case 2:
+                printf("Enter value to delete: ");
+                scanf("%d", &value);
+                sllDeleteByValue(&s, value);
+                break;
+
+            case 3:
+                sllDisplay(&s);
+                break;
+
+            case 4:
+                printf("Enter value to insert: ");
+                scanf("%d", &value);
+                dllInsertAtEnd(&s, value);
+                break;
+
+            case 5:
+                dllDeleteFromBeginning(&s);
+                break;
+
+            case 6:
+                dllDisplayBothSides(&s);
+                break;
+
+            case 7:
+                printf("Enter value to insert: ");
+                scanf("%d", &value);
+                treeInsert(&s, value);
+                break;
+
+            case 8:
+                printf("Enter value to search: ");
+                scanf("%d", &value);
+                if (treeSearch(&s, value))
+                    printf("Value %d found in BST.\n", value);
+                else
+                    printf("Value %d not found.\n", value);
+                break;
+
+            case 9:
+                printf("Inorder Traversal: ");
+                treeInorder(&s, s.treeRoot);
+                printf("\n");
+                break;
+
+            case 10:
+                showMemory(&s);
+                break;
+
+            case 11:
+                printf("Enter file name: ");
+                scanf("%255s", path);
+                saveStructures(&s, path);
+                break;
+
+            case 12:
+                printf("Enter file name: ");
+                scanf("%255s", path);
+                loadStructures(&s, path);
+                break;
+
+            case 13:
+                printf("Exiting program...\n");
+                destroyStructures(&s);
+                exit(0);
+
+            default:
+                printf("Invalid choice! Try again.\n");
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,310 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "instrument.h"
+#include "fastout.h"
+
+#define MAX_LEVEL 32  // Enough for 2^32 nodes with p = 1/2
+
+/* -------------------------- SKIP LIST --------------------------
+   A sorted singly linked list with extra "express lanes". Every
+   node is on level 0 (the 'next' chain, exactly like 01_sll.c).
+   Each node is also on level 1 with probability 1/2, on level 2
+   with probability 1/4, and so on. A search starts on the highest
+   level and drops down a level whenever the next node would
+   overshoot, so search, insert and delete take O(log n) expected.
+   No rebalancing is ever needed.
+------------------------------------------------------------------*/
+
+// Structure definition for a node in the skip list.
+// 'data' and 'next' are laid out as in the singly linked list, so
+// plain walks over 'next' (display, count) work unchanged.
+struct Node {
+    int data;                 // Data part to store value
+    struct Node* next;        // Level 0: the next node in sorted order
+    int height;               // Number of levels this node is on
+    struct Node* forward[];   // forward[i - 1] is the next node on level i
+};
+
+struct SkipList {
+    struct Node* head;   // Sentinel before the first node, on every level
+    int level;           // Highest level currently in use
+    int size;            // Number of values stored
+};
+
+STATS_DEFINE("skip_list");
+
+// Pointer to the link of 'node' on level 'lvl'
+struct Node** levelLink(struct Node* node, int lvl) {
+    return lvl == 0 ? &node->next : &node->forward[lvl - 1];
+}
+
+// Bytes of a node on 'height' levels (level 0 is 'next')
+size_t nodeSize(int height) {
+    return sizeof(struct Node) + (height - 1) * sizeof(struct Node*);
+}
+
+// Function to create a node on 'height' levels
+struct Node* createNode(int value, int height) {
+    struct Node* newNode = (struct Node*)malloc(nodeSize(height));
+    int i;
+
+    STAT_ALLOC(nodeSize(height));
+    newNode->data = value;
+    newNode->height = height;
+    for (i = 0; i < height; i++)
+        *levelLink(newNode, i) = NULL;
+    return newNode;
+}
+
+// Number of levels for a new node: 1 + number of "heads" in a row
+int randomHeight() {
+    int height = 1;
+    while (height < MAX_LEVEL && (rand() & 1))
+        height++;
+    return height;
+}
+
+void createSkipList(struct SkipList* list) {
+    list->head = createNode(0, MAX_LEVEL);
+    list->level = 1;
+    list->size = 0;
+}
+
+// Fills update[i] with the last node on level i whose value is less
+// than 'value', i.e. the node after which 'value' belongs
+void findPredecessors(struct SkipList* list, int value, struct Node** update) {
+    struct Node* temp = list->head;
+    int i;
+
+    for (i = list->level - 1; i >= 0; i--) {
+        while (*levelLink(temp, i) != NULL && STAT_CMP((*levelLink(temp, i))->data < value)) {
+            STAT_VISIT();
+            temp = *levelLink(temp, i);
+        }
+        update[i] = temp;
+    }
+}
+
+// Function to insert a value in sorted position (duplicates allowed)
+void insertNode(struct SkipList* list, int value) {
+    struct Node* update[MAX_LEVEL];
+    int height = randomHeight(), i;
+
+    findPredecessors(list, value, update);
+
+    // Levels above the current top start at the head
+    for (i = list->level; i < height; i++)
+        update[i] = list->head;
+    if (height > list->level)
+        list->level = height;
+
+    // Splice the node in on each of its levels
+    struct Node* newNode = createNode(value, height);
+    for (i = 0; i < height; i++) {
+        *levelLink(newNode, i) = *levelLink(update[i], i);
+        *levelLink(update[i], i) = newNode;
+    }
+
+    list->size++;
+    printf("Node inserted.\n");
+}
+
+// Function to delete one node with the given value
+void deleteByValue(struct SkipList* list, int value) {
+    struct Node* update[MAX_LEVEL];
+    int i;
+
+    findPredecessors(list, value, update);
+    struct Node* temp = update[0]->next;
+
+    if (temp == NULL || STAT_CMP(temp->data != value)) {
+        printf("Value not found.\n");
+        return;
+    }
+
+    // Unlink it on every level it is on
+    for (i = 0; i < temp->height; i++)
+        *levelLink(update[i], i) = *levelLink(temp, i);
+    STAT_FREE(nodeSize(temp->height));
+    free(temp);
+
+    // Drop levels that became empty
+    while (list->level > 1 && *levelLink(list->head, list->level - 1) == NULL)
+        list->level--;
+
+    list->size--;
+    printf("Node with value %d deleted.\n", value);
+}
+
+// Function to search for a value. Returns its node or NULL.
+struct Node* searchNode(struct SkipList* list, int value) {
+    struct Node* update[MAX_LEVEL];
+
+    findPredecessors(list, value, update);
+    struct Node* temp = update[0]->next;
+    return (temp != NULL && STAT_CMP(temp->data == value)) ? temp : NULL;
+}
+
+// Calls visit(value) for every value in [low, high], in order.
+// Returns how many values were visited.
+int rangeQuery(struct SkipList* list, int low, int high, void (*visit)(int)) {
+    struct Node* update[MAX_LEVEL];
+    int count = 0;
+
+    findPredecessors(list, low, update);
+    struct Node* temp = update[0]->next;
+
+    // From the first value >= low, walk level 0
+    while (temp != NULL && STAT_CMP(temp->data <= high)) {
+        STAT_VISIT();
+        visit(temp->data);
+        count++;
+        temp = temp->next;
+    }
+    return count;
+}
+
+// Function to display all nodes (level 0), as in 01_sll.c
+void displayList(struct Node* head) {
+    if (head == NULL) {
+        printf("List is empty.\n");
+        return;
+    }
+
+    struct Node* temp = head;
+    printf("Skip List: ");
+
+    // Traverse through the list and print data
+    while (temp != NULL) {
+        STAT_VISIT();
+        OUT_INT(temp->data, " -> ");
+        temp = temp->next;
+    }
+
+    OUT_TEXT("NULL\n");
+    OUT_FLUSH();
+}
+
+// Function to show every level, top to bottom
+void displayLevels(struct SkipList* list) {
+    int i;
+
+    for (i = list->level - 1; i >= 0; i--) {
+        struct Node* temp = *levelLink(list->head, i);
+        printf("Level %2d: ", i);
+        while (temp != NULL) {
+            STAT_VISIT();
+            OUT_INT(temp->data, " ");
+            temp = *levelLink(temp, i);
+        }
+        OUT_TEXT("\n");
+        OUT_FLUSH();  // Before the next printf
+    }
+}
+
+// Function to count the number of nodes (level 0 walk)
+int countNodes(struct Node* head) {
+    int count = 0;
+    struct Node* temp = head;
+
+    while (temp != NULL) {
+        count++;
+        temp = temp->next;
+    }
+
+    return count;
+}
+
+void destroySkipList(struct SkipList* list) {
+    struct Node* temp = list->head;
+
+    while (temp != NULL) {
+        struct Node* next = temp->next;
+        STAT_FREE(nodeSize(temp->height));
+        free(temp);
+        temp = next;
+    }
+}
+
+void printValue(int value) {
+    printf("%d ", value);
+}
+
+// Main function to test all operations
+int main() {
+    struct SkipList list;
+    int choice, value, low, high, count;
+
+    srand((unsigned)time(NULL));
+    createSkipList(&list);
+
+    while (1) {
+        printf("\n--- SKIP LIST OPERATIONS ---\n");
+        printf("1. Insert\n");
+        printf("2. Delete by Value\n");
+        printf("3. Search\n");
+        printf("4. Range Query\n");
+        printf("5. Display List\n");
+        printf("6. Display Levels\n");
+        printf("7. Count Nodes\n");
+        printf("8. Exit\n");
+        printf("Enter your choice: ");
+        scanf("%d", &choice);
+
+        switch (choice) {
+            case 1:
+                printf("Enter value to insert: ");
+                scanf("%d", &value);
+                insertNode(&list, value);
+                break;
+
+            case 2:
+                printf("Enter value to delete: ");
+                scanf("%d", &value);
+                deleteByValue(&list, value);
+                break;
+
+            case 3:
+                printf("Enter value to search: ");
+                scanf("%d", &value);
+                if (searchNode(&list, value) != NULL)
+                    printf("Value %d found.\n", value);
+                else
+                    printf("Value %d not found.\n", value);
+                break;
+
+            case 4:
+                printf("Enter low and high: ");
+                scanf("%d %d", &low, &high);
+                printf("Values in range: ");
+                count = rangeQuery(&list, low, high, printValue);
+                printf("\n%d value(s).\n", count);
+                break;
+
+            case 5:
+                displayList(list.head->next);
+                break;
+
+            case 6:
+                displayLevels(&list);
+                break;
+
+            case 7:
+                printf("Total nodes: %d (walk) / %d (stored)\n", countNodes(list.head->next), list.size);
+                break;
+
+            case 8:
+                printf("Exiting program...\n");
+                STAT_HEIGHT(list.level);
+                destroySkipList(&list);
+                STATS_DUMP();
+                exit(0);
+
+            default:
+                printf("Invalid choice! Try again.\n");
+        }
+    }
+
+    return 0;
+}
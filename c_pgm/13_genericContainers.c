@@ -0,0 +1,508 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* ---------------------- GENERIC CONTAINERS ----------------------
+   Every program in this folder stores 'int data'. To store larger
+   records, a 'void*' payload would cost an extra allocation and
+   an extra cache miss per element. Instead, each macro below writes
+   a complete container for ONE element type, with the element
+   stored inside the node (or array slot) itself:
+
+     DEFINE_SLL(Name, Type, EQUALS)        singly linked list  (01)
+     DEFINE_STACK(Name, Type)              linked stack        (02)
+     DEFINE_DLL(Name, Type)                doubly linked list  (03)
+     DEFINE_CQUEUE(Name, Type, SIZE)       circular queue      (04)
+     DEFINE_BST(Name, Type, LESS)          binary search tree  (06)
+
+   EQUALS(a, b) and LESS(a, b) receive 'const Type*' and are
+   normally small 'static inline' functions, so the compiler
+   inlines them into each instantiation. The result is as fast as
+   a hand-written container for that type.
+   Every function is named Name_operation, e.g. IntStack_push.
+-------------------------------------------------------------------*/
+
+/* ----------------------- SINGLY LINKED LIST ----------------------- */
+#define DEFINE_SLL(Name, Type, EQUALS)                                          \
+    struct Name##_Node {                                                        \
+        Type data;                                                              \
+        struct Name##_Node* next;                                               \
+    };                                                                          \
+    struct Name {                                                               \
+        struct Name##_Node* head;                                               \
+        int size;                                                               \
+    };                                                                          \
+    static inline void Name##_init(struct Name* list) {                         \
+        list->head = NULL;                                                      \
+        list->size = 0;                                                         \
+    }                                                                           \
+    static inline void Name##_insertAtBeginning(struct Name* list, const Type* value) { \
+        struct Name##_Node* node = (struct Name##_Node*)malloc(sizeof(*node));  \
+        node->data = *value;                                                    \
+        node->next = list->head;                                                \
+        list->head = node;                                                      \
+        list->size++;                                                           \
+    }                                                                           \
+    /* Removes the first element equal to *value; returns 1 if found */        \
+    static inline int Name##_deleteByValue(struct Name* list, const Type* value) { \
+        struct Name##_Node** link = &list->head;                                \
+        while (*link != NULL && !EQUALS(&(*link)->data, value))                 \
+            link = &(*link)->next;                                              \
+        if (*link == NULL)                                                      \
+            return 0;                                                           \
+        struct Name##_Node* temp = *link;                                       \
+        *link = temp->next;                                                     \
+        free(temp);                                                             \
+        list->size--;                                                           \
+        return 1;                                                               \
+    }                                                                           \
+    static inline Type* Name##_find(struct Name* list, const Type* value) {     \
+        struct Name##_Node* temp = list->head;                                  \
+        while (temp != NULL && !EQUALS(&temp->data, value))                     \
+            temp = temp->next;                                                  \
+        return temp != NULL ? &temp->data : NULL;                               \
+    }                                                                           \
+    static inline void Name##_destroy(struct Name* list) {                      \
+        while (list->head != NULL) {                                            \
+            struct Name##_Node* next = list->head->next;                        \
+            free(list->head);                                                   \
+            list->head = next;                                                  \
+        }                                                                       \
+        list->size = 0;                                                         \
+    }
+
+/* ------------------------- LINKED STACK ------------------------- */
+#define DEFINE_STACK(Name, Type)                                                \
+    struct Name##_Node {                                                        \
+        Type data;                                                              \
+        struct Name##_Node* next;                                               \
+    };                                                                          \
+    struct Name {                                                               \
+        struct Name##_Node* top;                                                \
+        int size;                                                               \
+    };                                                                          \
+    static inline void Name##_init(struct Name* stack) {                        \
+        stack->top = NULL;                                                      \
+        stack->size = 0;                                                        \
+    }                                                                           \
+    static inline void Name##_push(struct Name* stack, const Type* value) {     \
+        struct Name##_Node* node = (struct Name##_Node*)malloc(sizeof(*node));  \
+        node->data = *value;                                                    \
+        node->next = stack->top;                                                \
+        stack->top = node;                                                      \
+        stack->size++;                                                          \
+    }                                                                           \
+    /* Copies the top element to *out and removes it; 0 if empty */            \
+    static inline int Name##_pop(struct Name* stack, Type* out) {               \
+        struct Name##_Node* temp = stack->top;                                  \
+        if (temp == NULL)                                                       \
+            return 0;                                                           \
+        *out = temp->data;                                                      \
+        stack->top = temp->next;                                                \
+        free(temp);                                                             \
+        stack->size--;                                                          \
+        return 1;                                                               \
+    }                                                                           \
+    static inline void Name##_destroy(struct Name* stack) {                     \
+        Type ignored;                                                           \
+        while (Name##_pop(stack, &ignored))                                     \
+            ;                                                                   \
+    }
+
+/* ---------------------- DOUBLY LINKED LIST ---------------------- */
+#define DEFINE_DLL(Name, Type)                                                  \
+    struct Name##_Node {                                                        \
+        Type data;                                                              \
+        struct Name##_Node* prev;                                               \
+        struct Name##_Node* next;                                               \
+    };                                                                          \
+    struct Name {                                                               \
+        struct Name##_Node* head;                                               \
+        struct Name##_Node* tail;                                               \
+        int size;                                                               \
+    };                                                                          \
+    static inline void Name##_init(struct Name* list) {                         \
+        list->head = list->tail = NULL;                                         \
+        list->size = 0;                                                         \
+    }                                                                           \
+    static inline void Name##_insertAtBeginning(struct Name* list, const Type* value) { \
+        struct Name##_Node* node = (struct Name##_Node*)malloc(sizeof(*node));  \
+        node->data = *value;                                                    \
+        node->prev = NULL;                                                      \
+        node->next = list->head;                                                \
+        if (list->head != NULL)                                                 \
+            list->head->prev = node;                                            \
+        else                                                                    \
+            list->tail = node;                                                  \
+        list->head = node;                                                      \
+        list->size++;                                                           \
+    }                                                                           \
+    static inline void Name##_insertAtEnd(struct Name* list, const Type* value) { \
+        struct Name##_Node* node = (struct Name##_Node*)malloc(sizeof(*node));  \
+        node->data = *value;                                                    \
+        node->next = NULL;                                                      \
+        node->prev = list->tail;                                                \
+        if (list->tail != NULL)                                                 \
+            list->tail->next = node;                                            \
+        else                                                                    \
+            list->head = node;                                                  \
+        list->tail = node;                                                      \
+        list->size++;                                                           \
+    }                                                                           \
+    /* Unlinks a node, copies its data to *out and frees it */                 \
+    static inline void Name##_remove(struct Name* list, struct Name##_Node* node, Type* out) { \
+        if (node->prev != NULL)                                                 \
+            node->prev->next = node->next;                                      \
+        else                                                                    \
+            list->head = node->next;                                            \
+        if (node->next != NULL)                                                 \
+            node->next->prev = node->prev;                                      \
+        else                                                                    \
+            list->tail = node->prev;                                            \
+        *out = node->data;                                                      \
+        free(node);                                                             \
+        list->size--;                                                           \
+    }                                                                           \
+    static inline int Name##_deleteFromBeginning(struct Name* list, Type* out) { \
+        if (list->head == NULL)                                                 \
+            return 0;                                                           \
+        Name##_remove(list, list->head, out);                                   \
+        return 1;                                                               \
+    }                                                                           \
+    static inline int Name##_deleteFromEnd(struct Name* list, Type* out) {      \
+        if (list->tail == NULL)                                                 \
+            return 0;                                                           \
+        Name##_remove(list, list->tail, out);                                   \
+        return 1;                                                               \
+    }                                                                           \
+    static inline void Name##_destroy(struct Name* list) {                      \
+        Type ignored;                                                           \
+        while (Name##_deleteFromBeginning(list, &ignored))                      \
+            ;                                                                   \
+    }
+
+/* ------------------------ CIRCULAR QUEUE ------------------------ */
+#define DEFINE_CQUEUE(Name, Type, SIZE)                                         \
+    struct Name {                                                               \
+        Type items[SIZE];                                                       \
+        int front;   /* Index of the first element */                           \
+        int count;   /* Number of elements */                                   \
+    };                                                                          \
+    static inline void Name##_init(struct Name* q) {                            \
+        q->front = 0;                                                           \
+        q->count = 0;                                                           \
+    }                                                                           \
+    static inline int Name##_isFull(struct Name* q) { return q->count == (SIZE); } \
+    static inline int Name##_isEmpty(struct Name* q) { return q->count == 0; }  \
+    /* Returns 0 on overflow */                                                 \
+    static inline int Name##_enqueue(struct Name* q, const Type* value) {       \
+        if (Name##_isFull(q))                                                   \
+            return 0;                                                           \
+        q->items[(q->front + q->count) % (SIZE)] = *value;                      \
+        q->count++;                                                             \
+        return 1;                                                               \
+    }                                                                           \
+    /* Copies the front element to *out and removes it; 0 on underflow */      \
+    static inline int Name##_dequeue(struct Name* q, Type* out) {               \
+        if (Name##_isEmpty(q))                                                  \
+            return 0;                                                           \
+        *out = q->items[q->front];                                              \
+        q->front = (q->front + 1) % (SIZE);                                     \
+        q->count--;                                                             \
+        return 1;                                                               \
+    }                                                                           \
+    /* i-th element from the front (0 <= i < count) */                         \
+    static inline Type* Name##_at(struct Name* q, int i) {                      \
+        return &q->items[(q->front + i) % (SIZE)];                              \
+    }
+
+/* ---------------------- BINARY SEARCH TREE ---------------------- */
+#define DEFINE_BST(Name, Type, LESS)                                            \
+    struct Name##_Node {                                                        \
+        Type data;                                                              \
+        struct Name##_Node* left;                                               \
+        struct Name##_Node* right;                                              \
+    };                                                                          \
+    struct Name {                                                               \
+        struct Name##_Node* root;                                               \
+        int size;                                                               \
+    };                                                                          \
+    static inline void Name##_init(struct Name* tree) {                         \
+        tree->root = NULL;                                                      \
+        tree->size = 0;                                                         \
+    }                                                                           \
+    /* Returns 1 if inserted, 0 if an equal element exists (ignored) */        \
+    static inline int Name##_insert(struct Name* tree, const Type* value) {     \
+        struct Name##_Node** link = &tree->root;                                \
+        while (*link != NULL) {                                                 \
+            if (LESS(value, &(*link)->data))                                    \
+                link = &(*link)->left;                                          \
+            else if (LESS(&(*link)->data, value))                               \
+                link = &(*link)->right;                                         \
+            else                                                                \
+                return 0;                                                       \
+        }                                                                       \
+        *link = (struct Name##_Node*)malloc(sizeof(struct Name##_Node));        \
+        (*link)->data = *value;                                                 \
+        (*link)->left = (*link)->right = NULL;                                  \
+        tree->size++;                                                           \
+        return 1;                                                               \
+    }                                                                           \
+    static inline Type* Name##_search(struct Name* tree, const Type* value) {   \
+        struct Name##_Node* temp = tree->root;                                  \
+        while (temp != NULL) {                                                  \
+            if (LESS(value, &temp->data))                                       \
+                temp = temp->left;                                              \
+            else if (LESS(&temp->data, value))                                  \
+                temp = temp->right;                                             \
+            else                                                                \
+                return &temp->data;                                             \
+        }                                                                       \
+        return NULL;                                                            \
+    }                                                                           \
+    /* Returns 1 if an equal element was found and removed */                  \
+    static inline int Name##_delete(struct Name* tree, const Type* value) {     \
+        struct Name##_Node** link = &tree->root;                                \
+        while (*link != NULL && (LESS(value, &(*link)->data) || LESS(&(*link)->data, value))) \
+            link = LESS(value, &(*link)->data) ? &(*link)->left : &(*link)->right; \
+        if (*link == NULL)                                                      \
+            return 0;                                                           \
+        struct Name##_Node* temp = *link;                                       \
+        if (temp->left != NULL && temp->right != NULL) {                        \
+            /* Two children: move in the inorder successor */                   \
+            struct Name##_Node** succ = &temp->right;                           \
+            while ((*succ)->left != NULL)                                       \
+                succ = &(*succ)->left;                                          \
+            struct Name##_Node* s = *succ;                                      \
+            temp->data = s->data;                                               \
+            *succ = s->right;                                                   \
+            free(s);                                                            \
+        } else {                                                                \
+            *link = (temp->left != NULL) ? temp->left : temp->right;            \
+            free(temp);                                                         \
+        }                                                                       \
+        tree->size--;                                                           \
+        return 1;                                                               \
+    }                                                                           \
+    static inline void Name##_inorderNodes(struct Name##_Node* root, void (*visit)(const Type*)) { \
+        if (root == NULL)                                                       \
+            return;                                                             \
+        Name##_inorderNodes(root->left, visit);                                 \
+        visit(&root->data);                                                     \
+        Name##_inorderNodes(root->right, visit);                                \
+    }                                                                           \
+    static inline void Name##_inorder(struct Name* tree, void (*visit)(const Type*)) { \
+        Name##_inorderNodes(tree->root, visit);                                 \
+    }                                                                           \
+    static inline void Name##_freeNodes(struct Name##_Node* root) {             \
+        if (root == NULL)                                                       \
+            return;                                                             \
+        Name##_freeNodes(root->left);                                           \
+        Name##_freeNodes(root->right);                                          \
+        free(root);                                                             \
+    }                                                                           \
+    static inline void Name##_destroy(struct Name* tree) {                      \
+        Name##_freeNodes(tree->root);                                           \
+        Name##_init(tree);                                                      \
+    }
+
+/* ======================== INSTANTIATIONS ======================== */
+
+// A 40-byte record, stored inline in every container below
+struct Record {
+    int id;
+    char name[24];
+    double salary;
+};
+
+static inline int intEquals(const int* a, const int* b) { return *a == *b; }
+static inline int recordLess(const struct Record* a, const struct Record* b) { return a->id < b->id; }
+
+DEFINE_SLL(IntList, int, intEquals)
+DEFINE_STACK(IntStack, int)
+DEFINE_DLL(RecordDeque, struct Record)
+DEFINE_CQUEUE(RecordQueue, struct Record, 5)
+DEFINE_BST(RecordTree, struct Record, recordLess)
+
+/* ------------------------- DEMO HELPERS ------------------------- */
+
+void printRecord(const struct Record* r) {
+    printf("  [id %d, %s, %.2f]\n", r->id, r->name, r->salary);
+}
+
+void readRecord(struct Record* r) {
+    printf("Enter id, name and salary: ");
+    scanf("%d %23s %lf", &r->id, r->name, &r->salary);
+}
+
+void displayAll(struct RecordQueue* queue, struct RecordDeque* deque,
+                struct IntStack* stack, struct IntList* list) {
+    int i;
+
+    printf("Queue (%d):\n", queue->count);
+    for (i = 0; i < queue->count; i++)
+        printRecord(RecordQueue_at(queue, i));
+
+    printf("Deque (%d):\n", deque->size);
+    for (struct RecordDeque_Node* n = deque->head; n != NULL; n = n->next)
+        printRecord(&n->data);
+
+    printf("Stack (Top to Bottom): ");
+    for (struct IntStack_Node* n = stack->top; n != NULL; n = n->next)
+        printf("%d ", n->data);
+
+    printf("\nList: ");
+    for (struct IntList_Node* n = list->head; n != NULL; n = n->next)
+        printf("%d -> ", n->data);
+    printf("NULL\n");
+}
+
+// MAIN FUNCTION — Menu-driven program
+int main() {
+    struct RecordTree tree;
+    struct RecordQueue queue;
+    struct RecordDeque deque;
+    struct IntStack stack;
+    struct IntList list;
+    struct Record record;
+    int choice, value;
+
+    RecordTree_init(&tree);
+    RecordQueue_init(&queue);
+    RecordDeque_init(&deque);
+    IntStack_init(&stack);
+    IntList_init(&list);
+
+    while (1) {
+        printf("\n--- GENERIC CONTAINERS ---\n");
+        printf("1. Tree: Insert Record\n");
+        printf("2. Tree: Delete Record by Id\n");
+        printf("3. Tree: Search Record by Id\n");
+        printf("4. Tree: List Records in Order\n");
+        printf("5. Queue: Enqueue Record\n");
+        printf("6. Queue: Dequeue Record\n");
+        printf("7. Deque: Insert Record at Beginning\n");
+        printf("8. Deque: Insert Record at End\n");
+        printf("9. Deque: Delete from Beginning\n");
+        printf("10. Deque: Delete from End\n");
+        printf("11. Stack: Push Integer\n");
+        printf("12. Stack: Pop Integer\n");
+        printf("13. List: Insert Integer at Beginning\n");
+        printf("14. List: Delete Integer by Value\n");
+        printf("15. Display Queue, Deque, Stack and List\n");
+        printf("16. Exit\n");
+        printf("Enter your choice: ");
+        scanf("%d", &choice);
+
+        switch (choice) {
+            case 1:
+                readRecord(&record);
+                if (!RecordTree_insert(&tree, &record))
+                    printf("Duplicate id! Ignored.\n");
+                break;
+
+            case 2:
+                printf("Enter id: ");
+                scanf("%d", &record.id);
+                if (!RecordTree_delete(&tree, &record))
+                    printf("Id not found.\n");
+                break;
+
+            case 3: {
+                printf("Enter id: ");
+                scanf("%d", &record.id);
+                struct Record* found = RecordTree_search(&tree, &record);
+                if (found != NULL)
+                    printRecord(found);
+                else
+                    printf("Id %d not found.\n", record.id);
+                break;
+            }
+
+            case 4:
+                printf("Records (%d):\n", tree.size);
+                RecordTree_inorder(&tree, printRecord);
+                break;
+
+            case 5:
+                readRecord(&record);
+                if (!RecordQueue_enqueue(&queue, &record))
+                    printf("Queue Overflow! Cannot insert.\n");
+                break;
+
+            case 6:
+                if (RecordQueue_dequeue(&queue, &record))
+                    printRecord(&record);
+                else
+                    printf("Queue Underflow! Cannot delete.\n");
+                break;
+
+            case 7:
+                readRecord(&record);
+                RecordDeque_insertAtBeginning(&deque, &record);
+                break;
+
+            case 8:
+                readRecord(&record);
+                RecordDeque_insertAtEnd(&deque, &record);
+                break;
+
+            case 9:
+                if (RecordDeque_deleteFromBeginning(&deque, &record))
+                    printRecord(&record);
+                else
+                    printf("Deque is empty.\n");
+                break;
+
+            case 10:
+                if (RecordDeque_deleteFromEnd(&deque, &record))
+                    printRecord(&record);
+                else
+                    printf("Deque is empty.\n");
+                break;
+
+            case 11:
+                printf("Enter value to push: ");
+                scanf("%d", &value);
+                IntStack_push(&stack, &value);
+                break;
+
+            case 12:
+                if (IntStack_pop(&stack, &value))
+                    printf("%d popped from stack.\n", value);
+                else
+                    printf("Stack Underflow! Cannot pop.\n");
+                break;
+
+            case 13:
+                printf("Enter value to insert: ");
+                scanf("%d", &value);
+                IntList_insertAtBeginning(&list, &value);
+                break;
+
+            case 14:
+                printf("Enter value to delete: ");
+                scanf("%d", &value);
+                if (!IntList_deleteByValue(&list, &value))
+                    printf("Value not found.\n");
+                break;
+
+            case 15:
+                displayAll(&queue, &deque, &stack, &list);
+                break;
+
+            case 16:
+                printf("Exiting program...\n");
+                RecordTree_destroy(&tree);
+                RecordDeque_destroy(&deque);
+                IntStack_destroy(&stack);
+                IntList_destroy(&list);
+                exit(0);
+
+            default:
+                printf("Invalid choice! Try again.\n");
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,630 @@
+#define _DEFAULT_SOURCE  // clock_gettime, mmap and madvise also under -std=c11
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "instrument.h"
+#include "bulkload.h"
+
+#define DEFAULT_ARITY 4       // Four children share one or two cache lines
+#define MAX_ARITY 64          // Keeps d * slot + 1 far from overflowing
+#define INITIAL_CAPACITY 16
+
+/* ------------------------- D-ARY HEAP -------------------------
+   A priority queue stored the same way as the complete tree of
+   08_arrayBinaryTree.c, but every node has 'd' children instead
+   of two:
+       children of slot i: d*i + 1 ... d*i + d
+       parent of slot i:   (i - 1) / d
+   The heap rule is that no child comes before its parent, so the
+   first item (slot 0) is always the minimum (or the maximum).
+   A larger d makes the tree flatter (fewer levels to climb on push
+   and decrease-key) at the cost of comparing d children per level
+   on pop. d = 4 keeps all children of a slot close together.
+
+   Every pushed item gets a HANDLE, a small integer that stays valid
+   while the item is in the heap. 'pos[handle]' is the item's slot,
+   so an item's key can be changed in O(log n) without searching.
+------------------------------------------------------------------*/
+
+struct HeapItem {
+    int key;       // Priority
+    int handle;    // Which pushed item this is
+};
+
+struct DHeap {
+    int d;                    // Children per node (2 = binary heap)
+    int isMax;                // 1: largest key first, 0: smallest first
+
+    struct HeapItem* items;   // The tree in level order
+    int size;                 // Items in the heap
+    int capacity;             // Slots allocated in 'items'
+
+    int* pos;                 // handle -> slot, -1 if not in the heap
+    int handleCapacity;       // Entries allocated in 'pos'
+    int nextHandle;           // Next never-used handle
+    int* freeHandles;         // Handles of popped items, reused first
+    int freeCount;
+};
+
+STATS_DEFINE("d_ary_heap");
+
+void createHeap(struct DHeap* heap, int d, int isMax) {
+    heap->d = d < 2 ? 2 : d > MAX_ARITY ? MAX_ARITY : d;
+    heap->isMax = isMax;
+    heap->size = 0;
+    heap->capacity = INITIAL_CAPACITY;
+    heap->items = (struct HeapItem*)malloc(heap->capacity * sizeof(struct HeapItem));
+    heap->handleCapacity = INITIAL_CAPACITY;
+    heap->pos = (int*)malloc(heap->handleCapacity * sizeof(int));
+    heap->freeHandles = (int*)malloc(heap->handleCapacity * sizeof(int));
+    heap->nextHandle = 0;
+    heap->freeCount = 0;
+}
+
+void destroyHeap(struct DHeap* heap) {
+    free(heap->items);
+    free(heap->pos);
+    free(heap->freeHandles);
+    heap->items = NULL;
+    heap->pos = heap->freeHandles = NULL;
+    heap->size = heap->capacity = heap->handleCapacity = 0;
+}
+
+// Makes room for at least 'n' items and 'n' handles
+void reserve(struct DHeap* heap, int n) {
+    if (n > heap->capacity) {
+        while (heap->capacity < n)
+            heap->capacity *= 2;
+        heap->items = (struct HeapItem*)realloc(heap->items, heap->capacity * sizeof(struct HeapItem));
+    }
+    if (n > heap->handleCapacity) {
+        while (heap->handleCapacity < n)
+            heap->handleCapacity *= 2;
+        heap->pos = (int*)realloc(heap->pos, heap->handleCapacity * sizeof(int));
+        heap->freeHandles = (int*)realloc(heap->freeHandles, heap->handleCapacity * sizeof(int));
+    }
+}
+
+// 1 if key 'a' must come out before key 'b'
+int before(struct DHeap* heap, int a, int b) {
+    return STAT_CMP(heap->isMax ? a > b : a < b);
+}
+
+// Stores an item in a slot and records where it went
+void place(struct DHeap* heap, int slot, struct HeapItem item) {
+    heap->items[slot] = item;
+    heap->pos[item.handle] = slot;
+}
+
+// Moves the item in 'slot' towards the root while it beats its parent.
+// The item is held aside and parents are shifted down into the hole,
+// so each level costs one copy instead of a swap.
+void siftUp(struct DHeap* heap, int slot) {
+    struct HeapItem item = heap->items[slot];
+
+    while (slot > 0) {
+        int parent = (slot - 1) / heap->d;
+        STAT_VISIT();
+        if (!before(heap, item.key, heap->items[parent].key))
+            break;
+        place(heap, slot, heap->items[parent]);
+        slot = parent;
+    }
+    place(heap, slot, item);
+}
+
+// Moves the item in 'slot' down while one of its children beats it
+void siftDown(struct DHeap* heap, int slot) {
+    struct HeapItem item = heap->items[slot];
+
+    while (1) {
+        int first = heap->d * slot + 1;
+        int last = first + heap->d;
+        int best, c;
+
+        if (first >= heap->size)
+            break;
+        if (last > heap->size)
+            last = heap->size;
+        STAT_VISIT();
+
+        // Pick the child that must come out first
+        best = first;
+        for (c = first + 1; c < last; c++)
+            if (before(heap, heap->items[c].key, heap->items[best].key))
+                best = c;
+
+        if (!before(heap, heap->items[best].key, item.key))
+            break;
+        place(heap, slot, heap->items[best]);
+        slot = best;
+    }
+    place(heap, slot, item);
+}
+
+int newHandle(struct DHeap* heap) {
+    if (heap->freeCount > 0)
+        return heap->freeHandles[--heap->freeCount];
+    reserve(heap, heap->nextHandle + 1);
+    return heap->nextHandle++;
+}
+
+// Adds a key. Returns its handle.
+int push(struct DHeap* heap, int key) {
+    struct HeapItem item;
+
+    reserve(heap, heap->size + 1);
+    item.key = key;
+    item.handle = newHandle(heap);
+
+    place(heap, heap->size, item);
+    heap->size++;
+    siftUp(heap, heap->size - 1);
+    return item.handle;
+}
+
+// Removes the first item. Stores its key in *key and returns its
+// handle, or returns -1 if the heap is empty.
+int pop(struct DHeap* heap, int* key) {
+    struct HeapItem top;
+
+    if (heap->size == 0)
+        return -1;
+
+    top = heap->items[0];
+    heap->size--;
+    if (heap->size > 0) {
+        // The last item fills the root and sinks to its place
+        place(heap, 0, heap->items[heap->size]);
+        siftDown(heap, 0);
+    }
+
+    heap->pos[top.handle] = -1;
+    heap->freeHandles[heap->freeCount++] = top.handle;
+    *key = top.key;
+    return top.handle;
+}
+
+// Looks at the first item without removing it. Returns its handle,
+// or -1 if the heap is empty.
+int peek(struct DHeap* heap, int* key) {
+    if (heap->size == 0)
+        return -1;
+    *key = heap->items[0].key;
+    return heap->items[0].handle;
+}
+
+// 1 if 'handle' names an item currently in the heap
+int isLive(struct DHeap* heap, int handle) {
+    return handle >= 0 && handle < heap->nextHandle && heap->pos[handle] >= 0;
+}
+
+// Gives an item a new key. Moving it towards the front (a smaller key
+// in a min-heap, a larger one in a max-heap) is the classic
+// decrease-key and only sifts up: O(log n / log d). Moving it back
+// sifts down. Returns 0 if the handle is not in the heap.
+int changeKey(struct DHeap* heap, int handle, int key) {
+    int slot, oldKey;
+
+    if (!isLive(heap, handle))
+        return 0;
+
+    slot = heap->pos[handle];
+    oldKey = heap->items[slot].key;
+    heap->items[slot].key = key;
+
+    if (before(heap, key, oldKey))
+        siftUp(heap, slot);
+    else
+        siftDown(heap, slot);
+    return 1;
+}
+
+// Replaces the heap contents with 'n' keys in O(n): the keys are
+// copied in as they are, then every parent from the last one back
+// to the root is sifted down. Key i gets handle i.
+void heapify(struct DHeap* heap, const int* keys, int n) {
+    int i;
+
+    heap->size = 0;
+    heap->nextHandle = 0;
+    heap->freeCount = 0;
+    reserve(heap, n);
+
+    for (i = 0; i < n; i++) {
+        heap->items[i].key = keys[i];
+        heap->items[i].handle = i;
+        heap->pos[i] = i;
+    }
+    heap->size = n;
+    heap->nextHandle = n;
+
+    if (n > 1)
+        for (i = (n - 2) / heap->d; i >= 0; i--)
+            siftDown(heap, i);
+}
+
+// Number of levels: level k holds d^k slots
+int heapHeight(struct DHeap* heap) {
+    long levelEnd = 0, width = 1;
+    int height = 0;
+
+    while (levelEnd < heap->size) {
+        levelEnd += width;
+        width *= heap->d;
+        height++;
+    }
+    return height;
+}
+
+// Prints the heap level by level, each item as key(#handle)
+void displayHeap(struct DHeap* heap) {
+    int i, levelEnd = 1, width = 1, level = 0;
+
+    if (heap->size == 0) {
+        printf("Heap is empty.\n");
+        return;
+    }
+
+    printf("Level 0: ");
+    for (i = 0; i < heap->size; i++) {
+        if (i == levelEnd) {
+            // Level k holds d^k slots
+            width *= heap->d;
+            levelEnd += width;
+            printf("\nLevel %d: ", ++level);
+        }
+        printf("%d(#%d) ", heap->items[i].key, heap->items[i].handle);
+    }
+    printf("\n");
+}
+
+/* ------------------------ BENCHMARK ------------------------
+   The same workload on d-ary heaps and on a binary search tree
+   used as a priority queue (the way the schedulers do it now):
+   push n random keys, change m of them to earlier keys, then pop
+   everything. The BST keeps a count per key, since 06's BST
+   ignores duplicate keys; a key change there is delete + insert.
+------------------------------------------------------------*/
+
+struct TreeNode {
+    int key;
+    int count;                // How many times the key is queued
+    struct TreeNode* left;
+    struct TreeNode* right;
+};
+
+double nowSeconds() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+void bstPush(struct TreeNode** root, int key) {
+    struct TreeNode** link = root;
+
+    while (*link != NULL && (*link)->key != key)
+        link = key < (*link)->key ? &(*link)->left : &(*link)->right;
+
+    if (*link != NULL) {
+        (*link)->count++;
+        return;
+    }
+    *link = (struct TreeNode*)malloc(sizeof(struct TreeNode));
+    (*link)->key = key;
+    (*link)->count = 1;
+    (*link)->left = (*link)->right = NULL;
+}
+
+// Removes one copy of a key that is known to be in the tree
+void bstRemove(struct TreeNode** root, int key) {
+    struct TreeNode** link = root;
+    struct TreeNode* node;
+
+    while ((*link)->key != key)
+        link = key < (*link)->key ? &(*link)->left : &(*link)->right;
+
+    node = *link;
+    if (--node->count > 0)
+        return;
+
+    if (node->left == NULL) {
+        *link = node->right;
+    } else if (node->right == NULL) {
+        *link = node->left;
+    } else {
+        // Two children: move the inorder successor up
+        struct TreeNode** succ = &node->right;
+        while ((*succ)->left != NULL)
+            succ = &(*succ)->left;
+        struct TreeNode* s = *succ;
+        *succ = s->right;
+        s->left = node->left;
+        s->right = node->right;
+        *link = s;
+    }
+    free(node);
+}
+
+// Removes one copy of the smallest key
+int bstPopMin(struct TreeNode** root) {
+    struct TreeNode** link = root;
+    struct TreeNode* node;
+    int key;
+
+    while ((*link)->left != NULL)
+        link = &(*link)->left;
+
+    node = *link;
+    key = node->key;
+    if (--node->count == 0) {
+        *link = node->right;
+        free(node);
+    }
+    return key;
+}
+
+// Workload shared by both benchmarks
+struct Workload {
+    int n, m;
+    int* keys;        // Key of push i
+    int* target;      // Push whose key change j modifies
+    int* delta;       // How much earlier the new key is
+};
+
+// Prints the result line; 'check' is the sum of popped keys and
+// 'disorder' counts pops that came out before a smaller key
+void report(const char* name, double elapsed, long long check, int disorder) {
+    printf("%-16s %9.2f ms  (check %lld, %s)\n", name, elapsed * 1e3, check,
+           disorder == 0 ? "in order" : "OUT OF ORDER");
+}
+
+void benchmarkHeap(struct Workload* w, int d) {
+    struct DHeap heap;
+    int* handles = (int*)malloc(w->n * sizeof(int));
+    int* current = (int*)malloc(w->n * sizeof(int));
+    long long check = 0;
+    int i, key, last = 0, disorder = 0;
+    char name[32];
+
+    createHeap(&heap, d, 0);
+    double start = nowSeconds();
+
+    for (i = 0; i < w->n; i++) {
+        handles[i] = push(&heap, w->keys[i]);
+        current[i] = w->keys[i];
+    }
+    for (i = 0; i < w->m; i++) {
+        int t = w->target[i];
+        current[t] -= w->delta[i];
+        changeKey(&heap, handles[t], current[t]);
+    }
+    for (i = 0; i < w->n; i++) {
+        pop(&heap, &key);
+        if (i > 0 && key < last)
+            disorder++;
+        last = key;
+        check += key;
+    }
+
+    double elapsed = nowSeconds() - start;
+    sprintf(name, "%d-ary heap:", d);
+    report(name, elapsed, check, disorder);
+
+    destroyHeap(&heap);
+    free(handles);
+    free(current);
+}
+
+void benchmarkBST(struct Workload* w) {
+    struct TreeNode* root = NULL;
+    int* current = (int*)malloc(w->n * sizeof(int));
+    long long check = 0;
+    int i, key, last = 0, disorder = 0;
+
+    double start = nowSeconds();
+
+    for (i = 0; i < w->n; i++) {
+        bstPush(&root, w->keys[i]);
+        current[i] = w->keys[i];
+    }
+    for (i = 0; i < w->m; i++) {
+        int t = w->target[i];
+        bstRemove(&root, current[t]);
+        current[t] -= w->delta[i];
+        bstPush(&root, current[t]);
+    }
+    for (i = 0; i < w->n; i++) {
+        key = bstPopMin(&root);
+        if (i > 0 && key < last)
+            disorder++;
+        last = key;
+        check += key;
+    }
+
+    double elapsed = nowSeconds() - start;
+    report("BST as queue:", elapsed, check, disorder);
+    free(current);
+}
+
+void runBenchmark(int n) {
+    struct Workload w;
+    int i;
+
+    if (n < 1) {
+        printf("Nothing to benchmark.\n");
+        return;
+    }
+
+    w.n = n;
+    w.m = n / 2;
+    w.keys = (int*)malloc(n * sizeof(int));
+    w.target = (int*)malloc(w.m * sizeof(int));
+    w.delta = (int*)malloc(w.m * sizeof(int));
+
+    // Keys from a range of n/4 values, so many keys repeat
+    for (i = 0; i < n; i++)
+        w.keys[i] = rand() % (n / 4 + 1);
+    for (i = 0; i < w.m; i++) {
+        w.target[i] = rand() % n;
+        w.delta[i] = rand() % 100;
+    }
+
+    printf("%d pushes, %d key changes, %d pops:\n", w.n, w.m, w.n);
+    benchmarkHeap(&w, 2);
+    benchmarkHeap(&w, 4);
+    benchmarkHeap(&w, 8);
+    benchmarkBST(&w);
+
+    free(w.keys);
+    free(w.target);
+    free(w.delta);
+}
+
+// Collects loaded values for heapify (see bulkload.h)
+struct KeyArray {
+    int* keys;
+    size_t size, capacity;
+};
+
+void keyArraySink(const int* values, size_t count, void* ctx) {
+    struct KeyArray* a = (struct KeyArray*)ctx;
+
+    if (a->size + count > a->capacity) {
+        while (a->size + count > a->capacity)
+            a->capacity = a->capacity ? 2 * a->capacity : 1024;
+        a->keys = (int*)realloc(a->keys, a->capacity * sizeof(int));
+    }
+    memcpy(a->keys + a->size, values, count * sizeof(int));
+    a->size += count;
+}
+
+// MAIN FUNCTION — Menu-driven program
+int main() {
+    struct DHeap heap;
+    int choice, d, isMax, key, handle, n, i, format;
+    int* keys;
+    char path[256];
+    struct KeyArray loaded = { NULL, 0, 0 };
+
+    srand((unsigned)time(NULL));
+
+    printf("Enter number of children per node (0 for default %d): ", DEFAULT_ARITY);
+    scanf("%d", &d);
+    if (d <= 0)
+        d = DEFAULT_ARITY;
+    if (d > MAX_ARITY) {
+        printf("At most %d children per node; using %d.\n", MAX_ARITY, MAX_ARITY);
+        d = MAX_ARITY;
+    }
+    printf("Min-heap or max-heap? (0 = min, 1 = max): ");
+    scanf("%d", &isMax);
+    createHeap(&heap, d, isMax != 0);
+
+    while (1) {
+        printf("\n--- %d-ARY %s-HEAP OPERATIONS ---\n", heap.d, heap.isMax ? "MAX" : "MIN");
+        printf("1. Push\n");
+        printf("2. Pop\n");
+        printf("3. Peek\n");
+        printf("4. Change Key (decrease-key) by Handle\n");
+        printf("5. Build Heap from Values (heapify)\n");
+        printf("6. Display Heap\n");
+        printf("7. Count Items\n");
+        printf("8. Benchmark against BST as Priority Queue\n");
+        printf("10. Build Heap from File (heapify)\n");
+        printf("9. Exit\n");
+        printf("Enter your choice: ");
+        scanf("%d", &choice);
+
+        switch (choice) {
+            case 1:
+                printf("Enter key to push: ");
+                scanf("%d", &key);
+                handle = push(&heap, key);
+                printf("Pushed %d with handle #%d.\n", key, handle);
+                break;
+
+            case 2:
+                handle = pop(&heap, &key);
+                if (handle < 0)
+                    printf("Heap is empty.\n");
+                else
+                    printf("Popped %d (handle #%d).\n", key, handle);
+                break;
+
+            case 3:
+                handle = peek(&heap, &key);
+                if (handle < 0)
+                    printf("Heap is empty.\n");
+                else
+                    printf("Top item: %d (handle #%d).\n", key, handle);
+                break;
+
+            case 4:
+                printf("Enter handle and new key: ");
+                scanf("%d %d", &handle, &key);
+                if (changeKey(&heap, handle, key))
+                    printf("Key of handle #%d changed to %d.\n", handle, key);
+                else
+                    printf("Handle #%d is not in the heap.\n", handle);
+                break;
+
+            case 5:
+                printf("Enter number of values: ");
+                scanf("%d", &n);
+                if (n < 0)
+                    n = 0;
+                keys = (int*)malloc((n + 1) * sizeof(int));
+                printf("Enter %d values: ", n);
+                for (i = 0; i < n; i++)
+                    scanf("%d", &keys[i]);
+                heapify(&heap, keys, n);
+                free(keys);
+                if (n == 0)
+                    printf("Heap emptied.\n");
+                else
+                    printf("Heap rebuilt with %d items (handles #0 to #%d).\n", n, n - 1);
+                break;
+
+            case 6:
+                displayHeap(&heap);
+                break;
+
+            case 7:
+                printf("Total items: %d\n", heap.size);
+                break;
+
+            case 8:
+                printf("Enter number of keys: ");
+                scanf("%d", &n);
+                runBenchmark(n);
+                break;
+
+            case 9:
+                printf("Exiting program...\n");
+                STAT_HEIGHT(heapHeight(&heap));
+                STATS_DUMP();
+                destroyHeap(&heap);
+                free(loaded.keys);
+                exit(0);
+
+            // Added later, so it takes a new number and the
+            // original choices (and scripted input) keep working
+            case 10:
+                printf("Enter file name and format (0 = text, 1 = binary): ");
+                scanf("%255s %d", path, &format);
+                loaded.size = 0;
+                if (loadIntegers(path, format == 1 ? FORMAT_BINARY : FORMAT_TEXT, keyArraySink, &loaded) < 0)
+                    break;
+                heapify(&heap, loaded.keys, (int)loaded.size);
+                printf("Heap rebuilt with %d items from '%s'.\n", heap.size, path);
+                break;
+
+            default:
+                printf("Invalid choice! Try again.\n");
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,505 @@
+#define _DEFAULT_SOURCE  // clock_gettime also under -std=c11
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "instrument.h"
+#include "fastout.h"
+
+#define BLOCK_SHIFT 7
+#define BLOCK_SIZE (1 << BLOCK_SHIFT)   // 128 values (512 bytes) per block
+#define INITIAL_MAP_SIZE 8
+
+/* ------------------------ CHUNKED DEQUE ------------------------
+   The insert/delete-at-both-ends part of 03_dll.c, without a node
+   per value. Values live in fixed-size array BLOCKS. The blocks are
+   listed in order in a circular BLOCK MAP, so a new block can be
+   added before the first one or after the last one in O(1):
+
+       map:  [ . | B2 | B0 | B1 | . ]      (circular, first = B0)
+       B0:   [ . . . 4 5 6 ]    <- 'start' = offset of value 0 in B0
+       B1:   [ 7 8 9 10 11 12 ]
+       B2:   [ 13 14 . . . . ]
+
+   Value i is at position start + i counted across the blocks, so
+   it is found with one shift and one mask: O(1) access by index.
+   A block is allocated only when an end runs over a block edge and
+   freed when an end leaves one, instead of a malloc per value.
+------------------------------------------------------------------*/
+
+struct Deque {
+    int** map;          // Circular array of block pointers
+    int mapMask;        // Map size - 1 (size is a power of two)
+    int firstBlock;     // Map slot of the block holding value 0
+    int blockCount;     // Blocks in use, from firstBlock onwards
+    int start;          // Offset of value 0 in the first block
+    int size;           // Number of values stored
+    int* spare;         // One freed block kept for reuse, or NULL
+};
+
+STATS_DEFINE("chunked_deque");
+
+void createDeque(struct Deque* dq) {
+    dq->map = (int**)malloc(INITIAL_MAP_SIZE * sizeof(int*));
+    STAT_ALLOC(INITIAL_MAP_SIZE * sizeof(int*));
+    dq->mapMask = INITIAL_MAP_SIZE - 1;
+    dq->firstBlock = 0;
+    dq->blockCount = 0;
+    dq->start = 0;
+    dq->size = 0;
+    dq->spare = NULL;
+}
+
+// The b-th block in use (0 = first)
+int* blockAt(struct Deque* dq, int b) {
+    return dq->map[(dq->firstBlock + b) & dq->mapMask];
+}
+
+// Address of value 'index' (0 = front)
+int* slotAt(struct Deque* dq, int index) {
+    int pos = dq->start + index;
+    STAT_VISIT();
+    return blockAt(dq, pos >> BLOCK_SHIFT) + (pos & (BLOCK_SIZE - 1));
+}
+
+// A block from the spare slot, or a new one
+int* takeBlock(struct Deque* dq) {
+    int* block = dq->spare;
+    if (block != NULL) {
+        dq->spare = NULL;
+        return block;
+    }
+    block = (int*)malloc(BLOCK_SIZE * sizeof(int));
+    STAT_ALLOC(BLOCK_SIZE * sizeof(int));
+    return block;
+}
+
+// Keeps one emptied block, so pushing and popping across the same
+// block edge does not call malloc and free every time
+void releaseBlock(struct Deque* dq, int* block) {
+    if (dq->spare == NULL) {
+        dq->spare = block;
+    } else {
+        free(block);
+        STAT_FREE(BLOCK_SIZE * sizeof(int));
+    }
+}
+
+// Doubles the map when every slot holds a block. The blocks are
+// copied to the start of the new map in order.
+void growMapIfFull(struct Deque* dq) {
+    int oldSize = dq->mapMask + 1, b;
+
+    if (dq->blockCount < oldSize)
+        return;
+
+    int** newMap = (int**)malloc(2 * oldSize * sizeof(int*));
+    STAT_ALLOC(2 * oldSize * sizeof(int*));
+    for (b = 0; b < dq->blockCount; b++)
+        newMap[b] = blockAt(dq, b);
+
+    free(dq->map);
+    STAT_FREE(oldSize * sizeof(int*));
+    dq->map = newMap;
+    dq->mapMask = 2 * oldSize - 1;
+    dq->firstBlock = 0;
+}
+
+// Function to insert a value at the beginning
+void insertAtBeginning(struct Deque* dq, int value) {
+    // No room before value 0: add a block in front of the first one
+    if (dq->start == 0) {
+        growMapIfFull(dq);
+        dq->firstBlock = (dq->firstBlock - 1) & dq->mapMask;
+        dq->map[dq->firstBlock] = takeBlock(dq);
+        dq->blockCount++;
+        dq->start = BLOCK_SIZE;
+    }
+
+    dq->start--;
+    dq->size++;
+    *slotAt(dq, 0) = value;
+}
+
+// Function to insert a value at the end
+void insertAtEnd(struct Deque* dq, int value) {
+    // Last block is full (or there is none): add one after it
+    if (((dq->start + dq->size) >> BLOCK_SHIFT) == dq->blockCount) {
+        growMapIfFull(dq);
+        dq->map[(dq->firstBlock + dq->blockCount) & dq->mapMask] = takeBlock(dq);
+        dq->blockCount++;
+    }
+
+    *slotAt(dq, dq->size) = value;
+    dq->size++;
+}
+
+// Removes and returns the first value (deque must not be empty)
+int popFront(struct Deque* dq) {
+    int value = *slotAt(dq, 0);
+
+    dq->start++;
+    dq->size--;
+
+    // Walked off the end of the first block: it is no longer used
+    if (dq->start == BLOCK_SIZE) {
+        releaseBlock(dq, blockAt(dq, 0));
+        dq->firstBlock = (dq->firstBlock + 1) & dq->mapMask;
+        dq->blockCount--;
+        dq->start = 0;
+    }
+    return value;
+}
+
+// Removes and returns the last value (deque must not be empty)
+int popBack(struct Deque* dq) {
+    int value = *slotAt(dq, dq->size - 1);
+    int end;
+
+    dq->size--;
+    end = dq->start + dq->size;
+
+    // The end is now at the very start of the last block: it is empty
+    if ((end & (BLOCK_SIZE - 1)) == 0 && (end >> BLOCK_SHIFT) == dq->blockCount - 1) {
+        releaseBlock(dq, blockAt(dq, dq->blockCount - 1));
+        dq->blockCount--;
+    }
+    return value;
+}
+
+// Function to delete a value from the beginning
+void deleteFromBeginning(struct Deque* dq) {
+    if (dq->size == 0) {
+        printf("Deque is empty. Cannot delete.\n");
+        return;
+    }
+    printf("Value %d deleted from beginning.\n", popFront(dq));
+}
+
+// Function to delete a value from the end
+void deleteFromEnd(struct Deque* dq) {
+    if (dq->size == 0) {
+        printf("Deque is empty. Cannot delete.\n");
+        return;
+    }
+    printf("Value %d deleted from end.\n", popBack(dq));
+}
+
+// Function to delete the first occurrence of a value. The values on
+// the shorter side of it are shifted over the gap by one place, then
+// that end is popped: O(n), at most n/2 moves.
+void deleteByValue(struct Deque* dq, int value) {
+    int i, found = -1;
+
+    for (i = 0; i < dq->size; i++) {
+        if (STAT_CMP(*slotAt(dq, i) == value)) {
+            found = i;
+            break;
+        }
+    }
+
+    if (found < 0) {
+        printf("Value not found.\n");
+        return;
+    }
+
+    if (found < dq->size / 2) {
+        for (i = found; i > 0; i--)
+            *slotAt(dq, i) = *slotAt(dq, i - 1);
+        popFront(dq);
+    } else {
+        for (i = found; i < dq->size - 1; i++)
+            *slotAt(dq, i) = *slotAt(dq, i + 1);
+        popBack(dq);
+    }
+    printf("Value %d deleted.\n", value);
+}
+
+// Function to read the value at an index in O(1). Returns 0 if the
+// index is out of range.
+int getAt(struct Deque* dq, int index, int* value) {
+    if (index < 0 || index >= dq->size)
+        return 0;
+    *value = *slotAt(dq, index);
+    return 1;
+}
+
+// Function to traverse from the first value to the last,
+// one block at a time
+void traverseFromBeginning(struct Deque* dq) {
+    int pos, end = dq->start + dq->size;
+
+    if (dq->size == 0) {
+        printf("Deque is empty.\n");
+        return;
+    }
+
+    printf("Traversal from beginning: ");
+    for (pos = dq->start; pos < end; ) {
+        int* block = blockAt(dq, pos >> BLOCK_SHIFT);
+        int blockEnd = (pos | (BLOCK_SIZE - 1)) + 1;   // Start of next block
+        if (blockEnd > end)
+            blockEnd = end;
+        for (; pos < blockEnd; pos++) {
+            STAT_VISIT();
+            OUT_INT(block[pos & (BLOCK_SIZE - 1)], " ");
+        }
+    }
+    OUT_TEXT("\n");
+    OUT_FLUSH();
+}
+
+// Function to traverse from the last value back to the first
+void traverseFromEnd(struct Deque* dq) {
+    int pos;
+
+    if (dq->size == 0) {
+        printf("Deque is empty.\n");
+        return;
+    }
+
+    printf("Traversal from end: ");
+    for (pos = dq->start + dq->size - 1; pos >= dq->start; ) {
+        int* block = blockAt(dq, pos >> BLOCK_SHIFT);
+        int blockStart = pos & ~(BLOCK_SIZE - 1);
+        if (blockStart < dq->start)
+            blockStart = dq->start;
+        for (; pos >= blockStart; pos--) {
+            STAT_VISIT();
+            OUT_INT(block[pos & (BLOCK_SIZE - 1)], " ");
+        }
+    }
+    OUT_TEXT("\n");
+    OUT_FLUSH();
+}
+
+// Function to display both traversals
+void displayBothSides(struct Deque* dq) {
+    traverseFromBeginning(dq);
+    traverseFromEnd(dq);
+}
+
+// Function to count how many values are stored (O(1))
+int countValues(struct Deque* dq) {
+    return dq->size;
+}
+
+// Bytes held by the deque: blocks in use, the spare and the map
+long dequeBytes(struct Deque* dq) {
+    long blocks = dq->blockCount + (dq->spare != NULL);
+    return blocks * BLOCK_SIZE * (long)sizeof(int) + (dq->mapMask + 1) * (long)sizeof(int*);
+}
+
+void destroyDeque(struct Deque* dq) {
+    int b;
+
+    for (b = 0; b < dq->blockCount; b++) {
+        free(blockAt(dq, b));
+        STAT_FREE(BLOCK_SIZE * sizeof(int));
+    }
+    if (dq->spare != NULL) {
+        free(dq->spare);
+        STAT_FREE(BLOCK_SIZE * sizeof(int));
+    }
+    free(dq->map);
+    STAT_FREE((dq->mapMask + 1) * sizeof(int*));
+    dq->map = NULL;
+    dq->spare = NULL;
+    dq->blockCount = dq->size = dq->start = 0;
+}
+
+/* ------------------------ BENCHMARK ------------------------
+   The same workload as the XOR list benchmark in 10: fill from
+   both ends, walk forward and backward, then empty the structure
+   from both ends. The DLL uses one malloc per node, as in 03.
+------------------------------------------------------------*/
+
+struct DNode {
+    int data;
+    struct DNode* prev;
+    struct DNode* next;
+};
+
+double nowSeconds() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+void benchmarkDLL(int n) {
+    struct DNode *head = NULL, *tail = NULL, *temp;
+    long long sum = 0;
+    int i;
+
+    double start = nowSeconds();
+
+    for (i = 0; i < n; i++) {
+        struct DNode* node = (struct DNode*)malloc(sizeof(struct DNode));
+        node->data = i;
+        if (i % 2 == 0) {            // Even values at the front
+            node->prev = NULL;
+            node->next = head;
+            if (head) head->prev = node; else tail = node;
+            head = node;
+        } else {                     // Odd values at the back
+            node->next = NULL;
+            node->prev = tail;
+            if (tail) tail->next = node; else head = node;
+            tail = node;
+        }
+    }
+    for (temp = head; temp != NULL; temp = temp->next)
+        sum += temp->data;
+    for (temp = tail; temp != NULL; temp = temp->prev)
+        sum -= temp->data;
+    for (i = 0; head != NULL; i++) {
+        if (i % 2 == 0) {            // Alternate front and back deletes
+            temp = head;
+            head = head->next;
+            if (head) head->prev = NULL; else tail = NULL;
+        } else {
+            temp = tail;
+            tail = tail->prev;
+            if (tail) tail->next = NULL; else head = NULL;
+        }
+        free(temp);
+    }
+
+    double elapsed = nowSeconds() - start;
+    printf("Doubly linked list: %5.2f bytes/value, %8.2f MB for %d values, %8.2f ms (check %lld)\n",
+           (double)sizeof(struct DNode), n * (double)sizeof(struct DNode) / (1 << 20), n,
+           elapsed * 1e3, sum);
+}
+
+void benchmarkDeque(int n) {
+    struct Deque dq;
+    long long sum = 0;
+    long bytes;
+    int i, pos, end;
+
+    createDeque(&dq);
+    double start = nowSeconds();
+
+    for (i = 0; i < n; i++) {
+        if (i % 2 == 0)
+            insertAtBeginning(&dq, i);
+        else
+            insertAtEnd(&dq, i);
+    }
+    bytes = dequeBytes(&dq);
+
+    end = dq.start + dq.size;
+    for (pos = dq.start; pos < end; pos++)
+        sum += blockAt(&dq, pos >> BLOCK_SHIFT)[pos & (BLOCK_SIZE - 1)];
+    for (pos = end - 1; pos >= dq.start; pos--)
+        sum -= blockAt(&dq, pos >> BLOCK_SHIFT)[pos & (BLOCK_SIZE - 1)];
+    for (i = 0; dq.size > 0; i++) {
+        if (i % 2 == 0)
+            popFront(&dq);
+        else
+            popBack(&dq);
+    }
+
+    double elapsed = nowSeconds() - start;
+    printf("Chunked deque:      %5.2f bytes/value, %8.2f MB for %d values, %8.2f ms (check %lld)\n",
+           n > 0 ? (double)bytes / n : 0.0, bytes / (double)(1 << 20), n, elapsed * 1e3, sum);
+    destroyDeque(&dq);
+}
+
+// MAIN FUNCTION — Menu-driven program
+int main() {
+    struct Deque dq;
+    int choice, value, index;
+
+    createDeque(&dq);
+
+    while (1) {
+        printf("\n--- CHUNKED DEQUE OPERATIONS ---\n");
+        printf("1. Insert at Beginning\n");
+        printf("2. Insert at End\n");
+        printf("3. Delete from Beginning\n");
+        printf("4. Delete from End\n");
+        printf("5. Delete by Value\n");
+        printf("6. Traverse from Beginning\n");
+        printf("7. Traverse from End\n");
+        printf("8. Display from Both Sides\n");
+        printf("9. Count Number of Values\n");
+        printf("10. Get Value at Index\n");
+        printf("11. Benchmark against Doubly Linked List\n");
+        printf("12. Exit\n");
+        printf("Enter your choice: ");
+        scanf("%d", &choice);
+
+        switch (choice) {
+            case 1:
+                printf("Enter value to insert: ");
+                scanf("%d", &value);
+                insertAtBeginning(&dq, value);
+                printf("Value inserted at beginning.\n");
+                break;
+
+            case 2:
+                printf("Enter value to insert: ");
+                scanf("%d", &value);
+                insertAtEnd(&dq, value);
+                printf("Value inserted at end.\n");
+                break;
+
+            case 3:
+                deleteFromBeginning(&dq);
+                break;
+
+            case 4:
+                deleteFromEnd(&dq);
+                break;
+
+            case 5:
+                printf("Enter value to delete: ");
+                scanf("%d", &value);
+                deleteByValue(&dq, value);
+                break;
+
+            case 6:
+                traverseFromBeginning(&dq);
+                break;
+
+            case 7:
+                traverseFromEnd(&dq);
+                break;
+
+            case 8:
+                displayBothSides(&dq);
+                break;
+
+            case 9:
+                printf("Total number of values: %d\n", countValues(&dq));
+                break;
+
+            case 10:
+                printf("Enter index: ");
+                scanf("%d", &index);
+                if (getAt(&dq, index, &value))
+                    printf("Value at index %d: %d\n", index, value);
+                else
+                    printf("Index out of range.\n");
+                break;
+
+            case 11:
+                printf("Enter number of values: ");
+                scanf("%d", &value);
+                benchmarkDLL(value);
+                benchmarkDeque(value);
+                break;
+
+            case 12:
+                printf("Exiting program...\n");
+                destroyDeque(&dq);
+                STATS_DUMP();
+                exit(0);
+
+            default:
+                printf("Invalid choice! Please try again.\n");
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,366 @@
+// Compile with: gcc -O2 -pthread 16_workStealingDeque.c -o workStealingDeque
+#include <stdio.h>
+#include <stdlib.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <time.h>
+
+#define INITIAL_CAPACITY 8    // Slots in the first buffer (a power of two)
+#define MAX_THIEVES 64
+
+/* -------------------- WORK-STEALING DEQUE --------------------
+   The circular array of 04_cq.c, turned into the deque a
+   work-stealing scheduler keeps per thread (Chase & Lev, with the
+   C11 memory orders of Le, Pop, Cohen and Zappa Nardelli):
+
+       top                              bottom
+        v                                  v
+      [ t0 | t1 | t2 | ... | tn | free | free ]
+        ^ thieves steal here      ^ the owner pushes and pops here
+
+   'top' and 'bottom' only ever grow; slot i is buffer[i & mask].
+   - The OWNER pushes and pops at the bottom like a stack. Push is
+     plain loads and stores plus a release fence. Pop needs one full
+     fence and uses a CAS only when it races a thief for the last item.
+   - THIEVES take the oldest item at the top, claiming it with a
+     single CAS on 'top'. A failed CAS means another thread got it.
+   When the buffer is full the owner copies it into one twice the
+   size. Thieves may still be reading the old buffer, so it is kept
+   on a list and freed together with the deque.
+------------------------------------------------------------------*/
+
+enum { STEAL_OK, STEAL_EMPTY, STEAL_ABORT };
+
+struct Buffer {
+    long mask;                  // Capacity - 1
+    struct Buffer* retired;     // Older buffer this one replaced
+    atomic_int items[];         // Accessed relaxed; ordering comes from top/bottom
+};
+
+struct WSDeque {
+    atomic_long top;            // Next item a thief will take
+    atomic_long bottom;         // Next free slot for the owner
+    _Atomic(struct Buffer*) buffer;
+};
+
+struct Buffer* createBuffer(long capacity) {
+    struct Buffer* b = (struct Buffer*)malloc(sizeof(struct Buffer) + capacity * sizeof(atomic_int));
+    b->mask = capacity - 1;
+    b->retired = NULL;
+    return b;
+}
+
+void createDeque(struct WSDeque* dq) {
+    atomic_init(&dq->top, 0);
+    atomic_init(&dq->bottom, 0);
+    atomic_init(&dq->buffer, createBuffer(INITIAL_CAPACITY));
+}
+
+// Frees the current buffer and every buffer it replaced.
+// No other thread may be using the deque.
+void destroyDeque(struct WSDeque* dq) {
+    struct Buffer* b = atomic_load_explicit(&dq->buffer, memory_order_relaxed);
+
+    while (b != NULL) {
+        struct Buffer* older = b->retired;
+        free(b);
+        b = older;
+    }
+}
+
+// Owner only: copies items [top, bottom) into a buffer twice the size
+struct Buffer* grow(struct WSDeque* dq, struct Buffer* old, long top, long bottom) {
+    struct Buffer* b = createBuffer(2 * (old->mask + 1));
+    long i;
+
+    for (i = top; i < bottom; i++)
+        atomic_store_explicit(&b->items[i & b->mask],
+                              atomic_load_explicit(&old->items[i & old->mask], memory_order_relaxed),
+                              memory_order_relaxed);
+
+    b->retired = old;
+    // Release: a thief that sees the new buffer also sees its contents
+    atomic_store_explicit(&dq->buffer, b, memory_order_release);
+    return b;
+}
+
+// Owner only: adds a value at the bottom
+void push(struct WSDeque* dq, int value) {
+    long b = atomic_load_explicit(&dq->bottom, memory_order_relaxed);
+    long t = atomic_load_explicit(&dq->top, memory_order_acquire);
+    struct Buffer* buf = atomic_load_explicit(&dq->buffer, memory_order_relaxed);
+
+    if (b - t > buf->mask)
+        buf = grow(dq, buf, t, b);
+
+    atomic_store_explicit(&buf->items[b & buf->mask], value, memory_order_relaxed);
+    // The item must be visible before a thief can see the new bottom
+    atomic_thread_fence(memory_order_release);
+    atomic_store_explicit(&dq->bottom, b + 1, memory_order_relaxed);
+}
+
+// Owner only: removes the newest value. Returns 0 if the deque is empty.
+int pop(struct WSDeque* dq, int* value) {
+    long b = atomic_load_explicit(&dq->bottom, memory_order_relaxed) - 1;
+    struct Buffer* buf = atomic_load_explicit(&dq->buffer, memory_order_relaxed);
+    long t;
+    int ok = 1;
+
+    // Claim slot b first, then look at top. The fence makes sure a
+    // thief cannot read the old bottom after we have read top.
+    atomic_store_explicit(&dq->bottom, b, memory_order_relaxed);
+    atomic_thread_fence(memory_order_seq_cst);
+    t = atomic_load_explicit(&dq->top, memory_order_relaxed);
+
+    if (t <= b) {
+        *value = atomic_load_explicit(&buf->items[b & buf->mask], memory_order_relaxed);
+        if (t == b) {
+            // Last item: a thief may be taking it right now
+            if (!atomic_compare_exchange_strong_explicit(&dq->top, &t, t + 1,
+                                                         memory_order_seq_cst, memory_order_relaxed))
+                ok = 0;
+            atomic_store_explicit(&dq->bottom, b + 1, memory_order_relaxed);
+        }
+    } else {
+        // Already empty: undo the claim
+        ok = 0;
+        atomic_store_explicit(&dq->bottom, b + 1, memory_order_relaxed);
+    }
+    return ok;
+}
+
+// Any thread: takes the oldest value. Returns STEAL_OK, STEAL_EMPTY,
+// or STEAL_ABORT if another thread won the race (worth retrying).
+int steal(struct WSDeque* dq, int* value) {
+    long t = atomic_load_explicit(&dq->top, memory_order_acquire);
+    atomic_thread_fence(memory_order_seq_cst);
+    long b = atomic_load_explicit(&dq->bottom, memory_order_acquire);
+
+    if (t >= b)
+        return STEAL_EMPTY;
+
+    struct Buffer* buf = atomic_load_explicit(&dq->buffer, memory_order_acquire);
+    int v = atomic_load_explicit(&buf->items[t & buf->mask], memory_order_relaxed);
+
+    // Claim item t; only the thread whose CAS succeeds may use it
+    if (!atomic_compare_exchange_strong_explicit(&dq->top, &t, t + 1,
+                                                 memory_order_seq_cst, memory_order_relaxed))
+        return STEAL_ABORT;
+
+    *value = v;
+    return STEAL_OK;
+}
+
+// Number of items (exact only when no other thread is active)
+long dequeSize(struct WSDeque* dq) {
+    long b = atomic_load_explicit(&dq->bottom, memory_order_relaxed);
+    long t = atomic_load_explicit(&dq->top, memory_order_relaxed);
+    return b > t ? b - t : 0;
+}
+
+// Prints the items from top (next to be stolen) to bottom
+void displayDeque(struct WSDeque* dq) {
+    long t = atomic_load_explicit(&dq->top, memory_order_relaxed);
+    long b = atomic_load_explicit(&dq->bottom, memory_order_relaxed);
+    struct Buffer* buf = atomic_load_explicit(&dq->buffer, memory_order_relaxed);
+    long i;
+
+    if (t >= b) {
+        printf("Deque is empty.\n");
+        return;
+    }
+
+    printf("Top -> ");
+    for (i = t; i < b; i++)
+        printf("%d ", atomic_load_explicit(&buf->items[i & buf->mask], memory_order_relaxed));
+    printf("<- Bottom  (capacity %ld)\n", buf->mask + 1);
+}
+
+/* ------------------------ STRESS TEST ------------------------
+   One owner pushes 0 .. n-1 and pops some of them back, while many
+   thieves steal. Every value must be taken exactly once: each
+   thread marks what it took in 'taken', and the marks are checked
+   at the end. The buffer starts small, so it grows many times
+   while thieves are reading it.
+------------------------------------------------------------------*/
+
+struct StressTest {
+    struct WSDeque dq;
+    int n;
+    atomic_int* taken;          // taken[v] = times value v was taken
+    atomic_int done;            // Owner has pushed and drained everything
+};
+
+struct Thief {
+    pthread_t thread;
+    struct StressTest* test;
+    long stolen;
+    long aborts;
+};
+
+void* thiefMain(void* arg) {
+    struct Thief* thief = (struct Thief*)arg;
+    struct StressTest* test = thief->test;
+    int value, result;
+
+    while (1) {
+        result = steal(&test->dq, &value);
+        if (result == STEAL_OK) {
+            atomic_fetch_add_explicit(&test->taken[value], 1, memory_order_relaxed);
+            thief->stolen++;
+        } else if (result == STEAL_ABORT) {
+            thief->aborts++;
+        } else if (atomic_load_explicit(&test->done, memory_order_acquire)) {
+            break;
+        }
+    }
+    return NULL;
+}
+
+double nowSeconds() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+void stressTest(int n, int thieves) {
+    struct StressTest test;
+    struct Thief thief[MAX_THIEVES];
+    long popped = 0, stolen = 0, aborts = 0, missing = 0, twice = 0;
+    int i, value;
+
+    if (n < 1 || thieves < 1) {
+        printf("Need at least one value and one thief.\n");
+        return;
+    }
+    if (thieves > MAX_THIEVES)
+        thieves = MAX_THIEVES;
+
+    createDeque(&test.dq);
+    test.n = n;
+    test.taken = (atomic_int*)malloc(n * sizeof(atomic_int));
+    for (i = 0; i < n; i++)
+        atomic_init(&test.taken[i], 0);
+    atomic_init(&test.done, 0);
+
+    double start = nowSeconds();
+
+    for (i = 0; i < thieves; i++) {
+        thief[i].test = &test;
+        thief[i].stolen = thief[i].aborts = 0;
+        pthread_create(&thief[i].thread, NULL, thiefMain, &thief[i]);
+    }
+
+    // Owner: push everything, popping one value back after every
+    // third push, so pops and steals race near the bottom too
+    for (i = 0; i < n; i++) {
+        push(&test.dq, i);
+        if (i % 3 == 2 && pop(&test.dq, &value)) {
+            atomic_fetch_add_explicit(&test.taken[value], 1, memory_order_relaxed);
+            popped++;
+        }
+    }
+    while (pop(&test.dq, &value)) {
+        atomic_fetch_add_explicit(&test.taken[value], 1, memory_order_relaxed);
+        popped++;
+    }
+    atomic_store_explicit(&test.done, 1, memory_order_release);
+
+    for (i = 0; i < thieves; i++) {
+        pthread_join(thief[i].thread, NULL);
+        stolen += thief[i].stolen;
+        aborts += thief[i].aborts;
+    }
+    double elapsed = nowSeconds() - start;
+
+    for (i = 0; i < n; i++) {
+        int times = atomic_load_explicit(&test.taken[i], memory_order_relaxed);
+        if (times == 0)
+            missing++;
+        else if (times > 1)
+            twice++;
+    }
+
+    printf("%d values, %d thieves, %.2f ms\n", n, thieves, elapsed * 1e3);
+    printf("Popped by owner: %ld, stolen: %ld, lost CAS races: %ld\n", popped, stolen, aborts);
+    printf("Final buffer capacity: %ld\n",
+           atomic_load_explicit(&test.dq.buffer, memory_order_relaxed)->mask + 1);
+    if (missing == 0 && twice == 0)
+        printf("PASSED: every value was taken exactly once.\n");
+    else
+        printf("FAILED: %ld value(s) never taken, %ld taken more than once.\n", missing, twice);
+
+    destroyDeque(&test.dq);
+    free(test.taken);
+}
+
+// MAIN FUNCTION — Menu-driven program (single thread, except the stress test)
+int main() {
+    struct WSDeque dq;
+    int choice, value, result, thieves;
+
+    createDeque(&dq);
+
+    while (1) {
+        printf("\n--- WORK-STEALING DEQUE OPERATIONS ---\n");
+        printf("1. Push (owner, bottom)\n");
+        printf("2. Pop (owner, bottom)\n");
+        printf("3. Steal (thief, top)\n");
+        printf("4. Display Deque\n");
+        printf("5. Count Items\n");
+        printf("6. Stress Test with Many Thieves\n");
+        printf("7. Exit\n");
+        printf("Enter your choice: ");
+        if (scanf("%d", &choice) != 1)
+            break;
+
+        switch (choice) {
+            case 1:
+                printf("Enter value to push: ");
+                scanf("%d", &value);
+                push(&dq, value);
+                printf("%d pushed at the bottom.\n", value);
+                break;
+
+            case 2:
+                if (pop(&dq, &value))
+                    printf("%d popped from the bottom.\n", value);
+                else
+                    printf("Deque is empty. Cannot pop.\n");
+                break;
+
+            case 3:
+                result = steal(&dq, &value);
+                if (result == STEAL_OK)
+                    printf("%d stolen from the top.\n", value);
+                else
+                    printf("Deque is empty. Nothing to steal.\n");
+                break;
+
+            case 4:
+                displayDeque(&dq);
+                break;
+
+            case 5:
+                printf("Total items: %ld\n", dequeSize(&dq));
+                break;
+
+            case 6:
+                printf("Enter number of values and number of thieves: ");
+                scanf("%d %d", &value, &thieves);
+                stressTest(value, thieves);
+                break;
+
+            case 7:
+                printf("Exiting program...\n");
+                destroyDeque(&dq);
+                exit(0);
+
+            default:
+                printf("Invalid choice! Try again.\n");
+        }
+    }
+
+    destroyDeque(&dq);
+    return 0;
+}
@@ -0,0 +1,331 @@
+// Compile with: gcc -O2 -pthread 17_threadPool.c -o threadPool
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "threadpool.h"
+
+#define SORT_CUTOFF 4096    // Pieces smaller than this are sorted by one thread
+#define FIB_CUTOFF 0        // Spawn a task for every call (measures overhead)
+
+/* ----------------------- THREAD POOL DEMO -----------------------
+   Uses threadpool.h three ways:
+   - parallelFor: sum of squares over a range of numbers,
+   - fork-join:   naive Fibonacci, one task per call,
+   - fork-join:   merge sort of an array.
+   The benchmarks measure what one spawn costs and how a
+   parallel-for speeds up as workers are added.
+------------------------------------------------------------------*/
+
+double nowSeconds() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+/* -------------------- PARALLEL FOR: SUM -------------------- */
+
+struct SumJob {
+    atomic_llong total;
+    int work;               // Extra mixing rounds per number (makes it CPU bound)
+};
+
+// i * i, plus 'rounds' of CPU work per number when benchmarking
+// (the low bits of the mixed value are added so it is not optimized away)
+long long mix(long i, int rounds) {
+    unsigned long long x = (unsigned long long)i;
+    int r;
+    for (r = 0; r < rounds; r++) {
+        x ^= x << 13;
+        x ^= x >> 7;
+        x ^= x << 17;
+    }
+    return (long long)i * i + (rounds > 0 ? (long long)(x & 0xff) : 0);
+}
+
+void sumBody(long lo, long hi, void* ctx) {
+    struct SumJob* job = (struct SumJob*)ctx;
+    long long local = 0;
+    long i;
+
+    for (i = lo; i < hi; i++)
+        local += mix(i, job->work);
+    atomic_fetch_add_explicit(&job->total, local, memory_order_relaxed);
+}
+
+long long parallelSum(struct ThreadPool* pool, long n, int work) {
+    struct SumJob job;
+
+    atomic_init(&job.total, 0);
+    job.work = work;
+    parallelFor(pool, 0, n, 0, sumBody, &job);
+    return atomic_load(&job.total);
+}
+
+long long sequentialSum(long n, int work) {
+    long long total = 0;
+    long i;
+
+    for (i = 0; i < n; i++)
+        total += mix(i, work);
+    return total;
+}
+
+/* ------------------- FORK-JOIN: FIBONACCI ------------------- */
+
+struct FibJob {
+    struct ThreadPool* pool;
+    int n;
+    long long result;
+};
+
+long long fibSequential(int n) {
+    return n < 2 ? n : fibSequential(n - 1) + fibSequential(n - 2);
+}
+
+// fib(n - 1) is spawned, fib(n - 2) runs right here
+void fibTask(void* arg) {
+    struct FibJob* job = (struct FibJob*)arg;
+    struct FibJob left, right;
+    struct TaskGroup group;
+    struct Task task;
+
+    if (job->n < 2 || job->n <= FIB_CUTOFF) {
+        job->result = fibSequential(job->n);
+        return;
+    }
+
+    left.pool = right.pool = job->pool;
+    left.n = job->n - 1;
+    right.n = job->n - 2;
+
+    taskGroupInit(&group);
+    taskSpawn(job->pool, &task, fibTask, &left, &group);
+    fibTask(&right);
+    taskWait(job->pool, &group);
+
+    job->result = left.result + right.result;
+}
+
+long long parallelFib(struct ThreadPool* pool, int n) {
+    struct FibJob job;
+
+    job.pool = pool;
+    job.n = n;
+    poolRun(pool, fibTask, &job);
+    return job.result;
+}
+
+/* ------------------- FORK-JOIN: MERGE SORT ------------------- */
+
+struct SortJob {
+    struct ThreadPool* pool;
+    int* items;
+    int* temp;              // Scratch space of the same size
+    long n;
+};
+
+int compareInts(const void* a, const void* b) {
+    int x = *(const int*)a, y = *(const int*)b;
+    return (x > y) - (x < y);
+}
+
+// Sorts both halves in parallel, then merges them through 'temp'
+void sortTask(void* arg) {
+    struct SortJob* job = (struct SortJob*)arg;
+    struct SortJob left, right;
+    struct TaskGroup group;
+    struct Task task;
+    long half = job->n / 2, i = 0, j, k = 0;
+
+    if (job->n <= SORT_CUTOFF) {
+        qsort(job->items, job->n, sizeof(int), compareInts);
+        return;
+    }
+
+    left = *job;
+    left.n = half;
+    right = *job;
+    right.items += half;
+    right.temp += half;
+    right.n -= half;
+
+    taskGroupInit(&group);
+    taskSpawn(job->pool, &task, sortTask, &left, &group);
+    sortTask(&right);
+    taskWait(job->pool, &group);
+
+    // Merge items[0, half) and items[half, n)
+    j = half;
+    while (i < half && j < job->n)
+        job->temp[k++] = job->items[i] <= job->items[j] ? job->items[i++] : job->items[j++];
+    while (i < half)
+        job->temp[k++] = job->items[i++];
+    while (j < job->n)
+        job->temp[k++] = job->items[j++];
+    memcpy(job->items, job->temp, job->n * sizeof(int));
+}
+
+void parallelSort(struct ThreadPool* pool, int* items, long n) {
+    struct SortJob job;
+
+    job.pool = pool;
+    job.items = items;
+    job.temp = (int*)malloc((n > 0 ? n : 1) * sizeof(int));
+    job.n = n;
+    poolRun(pool, sortTask, &job);
+    free(job.temp);
+}
+
+/* ------------------------ BENCHMARKS ------------------------ */
+
+// Cost of one spawn: naive Fibonacci on one worker, every call a
+// task, against the same recursion without the pool
+void benchmarkSpawn(int n) {
+    struct ThreadPool pool;
+    long long tasks = 0, expected;
+    double start, sequential, pooled;
+    int i;
+
+    start = nowSeconds();
+    expected = fibSequential(n);
+    sequential = nowSeconds() - start;
+
+    createThreadPool(&pool, 1);
+    start = nowSeconds();
+    long long result = parallelFib(&pool, n);
+    pooled = nowSeconds() - start;
+    destroyThreadPool(&pool);
+
+    // The workers have been joined, so their counters are final
+    for (i = 0; i < pool.size; i++)
+        tasks += pool.workers[i].executed;
+
+    printf("fib(%d) = %lld (%s)\n", n, result, result == expected ? "correct" : "WRONG");
+    printf("Without pool: %8.2f ms\n", sequential * 1e3);
+    printf("One worker:   %8.2f ms, %lld tasks\n", pooled * 1e3, tasks);
+    if (tasks > 0)
+        printf("Spawn + run + wait overhead: %.1f ns per task\n",
+               (pooled - sequential) * 1e9 / tasks);
+}
+
+// Speed-up of a CPU-bound parallel-for from 1 worker to all cores
+void benchmarkScaling(long n) {
+    long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    long long expected = sequentialSum(n, 64), result;
+    double base = 0;
+    int workers, last = 0;
+
+    if (cpus < 1)
+        cpus = 1;
+    if (cpus > POOL_MAX_WORKERS)
+        cpus = POOL_MAX_WORKERS;
+
+    printf("Sum over %ld numbers, %ld core(s) online:\n", n, cpus);
+    for (workers = 1; last != (int)cpus; workers *= 2) {
+        struct ThreadPool pool;
+        long steals = 0;
+        int i;
+
+        if (workers > cpus)
+            workers = (int)cpus;
+        last = workers;
+
+        createThreadPool(&pool, workers);
+        double start = nowSeconds();
+        result = parallelSum(&pool, n, 64);
+        double elapsed = nowSeconds() - start;
+        destroyThreadPool(&pool);
+
+        for (i = 0; i < pool.size; i++)
+            steals += pool.workers[i].stolen;
+        if (workers == 1)
+            base = elapsed;
+
+        printf("%3d worker(s): %9.2f ms  speed-up %5.2fx  steals %6ld  %s\n",
+               workers, elapsed * 1e3, base / elapsed, steals,
+               result == expected ? "ok" : "WRONG");
+    }
+}
+
+// MAIN FUNCTION — Menu-driven program
+int main() {
+    struct ThreadPool pool;
+    int choice, n, sorted;
+    long count, i;
+    int* items;
+    double start, elapsed;
+
+    createThreadPool(&pool, 0);
+
+    while (1) {
+        printf("\n--- THREAD POOL (%d workers) ---\n", pool.size);
+        printf("1. Parallel Sum of Squares (parallel-for)\n");
+        printf("2. Parallel Fibonacci (fork-join)\n");
+        printf("3. Parallel Merge Sort of Random Values\n");
+        printf("4. Benchmark Task Spawn Overhead\n");
+        printf("5. Benchmark Scaling to All Cores\n");
+        printf("6. Exit\n");
+        printf("Enter your choice: ");
+        if (scanf("%d", &choice) != 1)
+            break;
+
+        switch (choice) {
+            case 1:
+                printf("Enter N: ");
+                scanf("%ld", &count);
+                printf("Sum of i*i for i < %ld: %lld\n", count, parallelSum(&pool, count, 0));
+                break;
+
+            case 2:
+                printf("Enter n (up to about 35): ");
+                scanf("%d", &n);
+                printf("fib(%d) = %lld\n", n, parallelFib(&pool, n));
+                break;
+
+            case 3:
+                printf("Enter number of values: ");
+                scanf("%ld", &count);
+                if (count < 1) {
+                    printf("Nothing to sort.\n");
+                    break;
+                }
+                items = (int*)malloc(count * sizeof(int));
+                for (i = 0; i < count; i++)
+                    items[i] = rand();
+                start = nowSeconds();
+                parallelSort(&pool, items, count);
+                elapsed = nowSeconds() - start;
+                sorted = 1;
+                for (i = 1; i < count; i++)
+                    if (items[i - 1] > items[i])
+                        sorted = 0;
+                printf("Sorted %ld values in %.2f ms (%s).\n", count, elapsed * 1e3,
+                       sorted ? "in order" : "NOT SORTED");
+                free(items);
+                break;
+
+            case 4:
+                printf("Enter n for fib(n) (e.g. 25): ");
+                scanf("%d", &n);
+                benchmarkSpawn(n);
+                break;
+
+            case 5:
+                printf("Enter number of values (e.g. 2000000): ");
+                scanf("%ld", &count);
+                benchmarkScaling(count);
+                break;
+
+            case 6:
+                printf("Exiting program...\n");
+                destroyThreadPool(&pool);
+                exit(0);
+
+            default:
+                printf("Invalid choice! Try again.\n");
+        }
+    }
+
+    destroyThreadPool(&pool);
+    return 0;
+}
@@ -0,0 +1,419 @@
+#define _DEFAULT_SOURCE  // clock_gettime also under -std=c11
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdatomic.h>
+#include <time.h>
+
+#define MAX_SNAPSHOTS 64
+
+/* ----------------------- PERSISTENT BST -----------------------
+   The binary search tree of 06_binarySearchTree.c, but no node is
+   ever changed after it is created. insertNode and deleteNode copy
+   only the nodes on the path from the root to the change and
+   return the root of a NEW version; every other node is shared
+   with the old version:
+
+         old root  50              new root  50'     (insert 65)
+                  /  \                      /   \
+                30    70     ===>         30     70'
+                     /                          /  \
+                   60                         60    65
+
+   So a SNAPSHOT is just a pointer to a root, taken in O(1), and an
+   update costs O(height) new nodes instead of copying the tree.
+
+   Reclamation: every node counts the references to it (parents and
+   version roots). Dropping the last reference to a node frees it and
+   drops its references to its children. The counts are atomic, so
+   a reader thread may drop its snapshot while the writer goes on.
+------------------------------------------------------------------*/
+
+struct Node {
+    int data;              // Data value of the node
+    struct Node* left;     // Pointer to the left child
+    struct Node* right;    // Pointer to the right child
+    atomic_int refCount;   // Parents and roots pointing here
+};
+
+atomic_long liveNodes = 0; // Nodes allocated and not yet freed
+
+// Creates a node holding one reference (owned by the caller)
+struct Node* createNode(int value, struct Node* left, struct Node* right) {
+    struct Node* newNode = (struct Node*)malloc(sizeof(struct Node));
+    newNode->data = value;
+    newNode->left = left;
+    newNode->right = right;
+    atomic_init(&newNode->refCount, 1);
+    atomic_fetch_add_explicit(&liveNodes, 1, memory_order_relaxed);
+    return newNode;
+}
+
+// Takes one more reference to a (sub)tree. Returns it for convenience.
+struct Node* retain(struct Node* node) {
+    if (node != NULL)
+        atomic_fetch_add_explicit(&node->refCount, 1, memory_order_relaxed);
+    return node;
+}
+
+// Drops one reference. A node nobody points to is freed, which in
+// turn drops its references to its children.
+void release(struct Node* node) {
+    while (node != NULL) {
+        if (atomic_fetch_sub_explicit(&node->refCount, 1, memory_order_acq_rel) != 1)
+            return;
+
+        struct Node* right = node->right;
+        release(node->left);
+        free(node);
+        atomic_fetch_sub_explicit(&liveNodes, 1, memory_order_relaxed);
+        node = right;      // Loop instead of recursing on the right
+    }
+}
+
+// Function to search for a value (same as in 06)
+struct Node* searchNode(struct Node* root, int value) {
+    while (root != NULL && root->data != value)
+        root = value < root->data ? root->left : root->right;
+    return root;
+}
+
+// Function to find the node with the minimum value
+struct Node* findMin(struct Node* root) {
+    while (root && root->left != NULL)
+        root = root->left;
+    return root;
+}
+
+// Copies the path to where 'value' belongs; 'value' is not in the tree
+struct Node* insertPath(struct Node* root, int value) {
+    if (root == NULL)
+        return createNode(value, NULL, NULL);
+
+    if (value < root->data)
+        return createNode(root->data, insertPath(root->left, value), retain(root->right));
+    else
+        return createNode(root->data, retain(root->left), insertPath(root->right, value));
+}
+
+// Copies the path to 'value' and leaves it out; 'value' is in the tree
+struct Node* deletePath(struct Node* root, int value) {
+    if (value < root->data)
+        return createNode(root->data, deletePath(root->left, value), retain(root->right));
+    if (value > root->data)
+        return createNode(root->data, retain(root->left), deletePath(root->right, value));
+
+    // Node to be deleted found: its children are shared, not copied
+    if (root->left == NULL)
+        return retain(root->right);
+    if (root->right == NULL)
+        return retain(root->left);
+
+    // Two children: the inorder successor's value takes its place
+    struct Node* succ = findMin(root->right);
+    return createNode(succ->data, retain(root->left), deletePath(root->right, succ->data));
+}
+
+/////////////////////////////////////
+// INSERT / DELETE: RETURN A NEW VERSION
+/////////////////////////////////////
+// Both leave 'root' untouched and return a new reference to the new
+// version (which is 'root' itself if nothing had to change). The
+// caller releases the old version when it no longer needs it.
+struct Node* insertNode(struct Node* root, int value) {
+    if (searchNode(root, value) != NULL) {
+        printf("Duplicate value! Ignored.\n");
+        return retain(root);
+    }
+    return insertPath(root, value);
+}
+
+struct Node* deleteNode(struct Node* root, int value) {
+    if (searchNode(root, value) == NULL) {
+        printf("Value not found.\n");
+        return retain(root);
+    }
+    return deletePath(root, value);
+}
+
+/////////////////////////////////////
+// TRAVERSALS (same as in 06)
+/////////////////////////////////////
+void inorder(struct Node* root) {
+    if (root == NULL)
+        return;
+    inorder(root->left);
+    printf("%d ", root->data);
+    inorder(root->right);
+}
+
+void preorder(struct Node* root) {
+    if (root == NULL)
+        return;
+    printf("%d ", root->data);
+    preorder(root->left);
+    preorder(root->right);
+}
+
+void postorder(struct Node* root) {
+    if (root == NULL)
+        return;
+    postorder(root->left);
+    postorder(root->right);
+    printf("%d ", root->data);
+}
+
+int countNodes(struct Node* root) {
+    if (root == NULL)
+        return 0;
+    return 1 + countNodes(root->left) + countNodes(root->right);
+}
+
+/* ------------------------ BENCHMARK ------------------------
+   A writer inserts new values into a tree of n nodes and takes a
+   snapshot after every insert, keeping all of them. Compared with
+   deep-copying the tree for every snapshot, as 06 would have to.
+------------------------------------------------------------*/
+
+double nowSeconds() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// Full copy of a tree (every node new)
+struct Node* copyTree(struct Node* root) {
+    if (root == NULL)
+        return NULL;
+    return createNode(root->data, copyTree(root->left), copyTree(root->right));
+}
+
+// Random distinct values: a shuffled first, first + 2, first + 4, ...
+int* shuffledValues(int n, int first) {
+    int* values = (int*)malloc(n * sizeof(int));
+    int i;
+
+    for (i = 0; i < n; i++)
+        values[i] = first + 2 * i;
+    for (i = n - 1; i > 0; i--) {
+        int j = rand() % (i + 1), t = values[i];
+        values[i] = values[j];
+        values[j] = t;
+    }
+    return values;
+}
+
+// The tree holds even values; the inserts between snapshots use odd
+// ones, so every insert adds a node. At most n snapshots.
+void runBenchmark(int n, int snapshots) {
+    int* values = shuffledValues(n, 0);
+    int* inserts = shuffledValues(n, 1);
+    struct Node** kept = (struct Node**)malloc(snapshots * sizeof(struct Node*));
+    struct Node *root = NULL, *next;
+    long before, peak[2];
+    double elapsed[2];
+    int mode, i;
+
+    for (i = 0; i < n; i++) {
+        next = insertPath(root, values[i]);
+        release(root);
+        root = next;
+    }
+    before = atomic_load(&liveNodes);
+    if (snapshots > n)
+        snapshots = n;
+
+    for (mode = 0; mode < 2; mode++) {
+        struct Node* current = retain(root);
+        double start = nowSeconds();
+
+        for (i = 0; i < snapshots; i++) {
+            // mode 0: deep copy, mode 1: share the root
+            kept[i] = mode == 0 ? copyTree(current) : retain(current);
+            next = insertPath(current, inserts[i]);
+            release(current);
+            current = next;
+        }
+
+        elapsed[mode] = nowSeconds() - start;
+        peak[mode] = atomic_load(&liveNodes) - before;
+        for (i = 0; i < snapshots; i++)
+            release(kept[i]);
+        release(current);
+    }
+
+    printf("%d snapshots of a %d-node tree, one insert between snapshots:\n", snapshots, n);
+    printf("Deep copy:     %9.2f ms, %10ld extra nodes (%.2f MB)\n", elapsed[0] * 1e3, peak[0],
+           peak[0] * (double)sizeof(struct Node) / (1 << 20));
+    printf("Path copying:  %9.2f ms, %10ld extra nodes (%.2f MB)\n", elapsed[1] * 1e3, peak[1],
+           peak[1] * (double)sizeof(struct Node) / (1 << 20));
+
+    release(root);
+    free(kept);
+    free(values);
+    free(inserts);
+}
+
+/////////////////////////////////////
+// MAIN FUNCTION — MENU DRIVEN PROGRAM
+/////////////////////////////////////
+int main() {
+    struct Node* root = NULL;                    // Current version
+    struct Node* snapshot[MAX_SNAPSHOTS] = { NULL };
+    int taken[MAX_SNAPSHOTS] = { 0 };            // 1 if slot holds a snapshot
+    int choice, value, id, count, i;
+    struct Node* next;
+
+    srand((unsigned)time(NULL));
+
+    while (1) {
+        printf("\n--- PERSISTENT BINARY SEARCH TREE OPERATIONS ---\n");
+        printf("1. Insert Node\n");
+        printf("2. Delete Node\n");
+        printf("3. Search Node\n");
+        printf("4. Inorder Traversal\n");
+        printf("5. Preorder Traversal\n");
+        printf("6. Postorder Traversal\n");
+        printf("7. Take Snapshot\n");
+        printf("8. Inorder Traversal of a Snapshot\n");
+        printf("9. Search in a Snapshot\n");
+        printf("10. Drop Snapshot\n");
+        printf("11. List Snapshots and Memory\n");
+        printf("12. Benchmark against Deep Copy\n");
+        printf("13. Exit\n");
+        printf("Enter your choice: ");
+        scanf("%d", &choice);
+
+        switch (choice) {
+            // Each update makes a new version and drops the old one
+            // (snapshots still holding it keep it alive)
+            case 1:
+                printf("Enter value to insert: ");
+                scanf("%d", &value);
+                next = insertNode(root, value);
+                release(root);
+                root = next;
+                break;
+
+            case 2:
+                printf("Enter value to delete: ");
+                scanf("%d", &value);
+                next = deleteNode(root, value);
+                release(root);
+                root = next;
+                break;
+
+            case 3:
+                printf("Enter value to search: ");
+                scanf("%d", &value);
+                if (searchNode(root, value) != NULL)
+                    printf("Value %d found in BST.\n", value);
+                else
+                    printf("Value %d not found.\n", value);
+                break;
+
+            case 4:
+                printf("Inorder Traversal: ");
+                inorder(root);
+                printf("\n");
+                break;
+
+            case 5:
+                printf("Preorder Traversal: ");
+                preorder(root);
+                printf("\n");
+                break;
+
+            case 6:
+                printf("Postorder Traversal: ");
+                postorder(root);
+                printf("\n");
+                break;
+
+            // O(1): the snapshot shares every node with the current version
+            case 7:
+                for (id = 0; id < MAX_SNAPSHOTS && taken[id]; id++)
+                    ;
+                if (id == MAX_SNAPSHOTS) {
+                    printf("No free snapshot slot. Drop one first.\n");
+                    break;
+                }
+                snapshot[id] = retain(root);
+                taken[id] = 1;
+                printf("Snapshot #%d taken.\n", id);
+                break;
+
+            case 8:
+                printf("Enter snapshot number: ");
+                scanf("%d", &id);
+                if (id < 0 || id >= MAX_SNAPSHOTS || !taken[id]) {
+                    printf("No such snapshot.\n");
+                    break;
+                }
+                printf("Snapshot #%d Inorder: ", id);
+                inorder(snapshot[id]);
+                printf("\n");
+                break;
+
+            case 9:
+                printf("Enter snapshot number and value: ");
+                scanf("%d %d", &id, &value);
+                if (id < 0 || id >= MAX_SNAPSHOTS || !taken[id]) {
+                    printf("No such snapshot.\n");
+                    break;
+                }
+                if (searchNode(snapshot[id], value) != NULL)
+                    printf("Value %d found in snapshot #%d.\n", value, id);
+                else
+                    printf("Value %d not found in snapshot #%d.\n", value, id);
+                break;
+
+            case 10:
+                printf("Enter snapshot number: ");
+                scanf("%d", &id);
+                if (id < 0 || id >= MAX_SNAPSHOTS || !taken[id]) {
+                    printf("No such snapshot.\n");
+                    break;
+                }
+                release(snapshot[id]);
+                snapshot[id] = NULL;
+                taken[id] = 0;
+                printf("Snapshot #%d dropped.\n", id);
+                break;
+
+            case 11:
+                count = countNodes(root);
+                printf("Current version: %d nodes\n", count);
+                for (i = 0; i < MAX_SNAPSHOTS; i++) {
+                    if (taken[i]) {
+                        printf("Snapshot #%d: %d nodes\n", i, countNodes(snapshot[i]));
+                        count += countNodes(snapshot[i]);
+                    }
+                }
+                printf("Nodes in all versions: %d, nodes in memory: %ld (%ld saved by sharing)\n",
+                       count, atomic_load(&liveNodes), count - atomic_load(&liveNodes));
+                break;
+
+            case 12:
+                printf("Enter tree size and number of snapshots: ");
+                scanf("%d %d", &value, &count);
+                if (value < 1 || count < 1) {
+                    printf("Both must be at least 1.\n");
+                    break;
+                }
+                runBenchmark(value, count);
+                break;
+
+            case 13:
+                printf("Exiting program...\n");
+                for (i = 0; i < MAX_SNAPSHOTS; i++)
+                    if (taken[i])
+                        release(snapshot[i]);
+                release(root);
+                exit(0);
+
+            default:
+                printf("Invalid choice! Try again.\n");
+        }
+    }
+    return 0;
+}
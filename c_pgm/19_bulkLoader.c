@@ -0,0 +1,309 @@
+#define _DEFAULT_SOURCE  // clock_gettime, mmap and madvise also under -std=c11
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "bulkload.h"
+
+#define PATH_LENGTH 256
+
+/* ------------------------ BULK LOADER DEMO ------------------------
+   Loads integer files with bulkload.h and feeds them to different
+   "sinks": a running summary, and the bulk build of a balanced BST
+   (sort once, then build the tree from the middle out, instead of
+   n separate inserts). Also writes test files, and compares the
+   loader with reading the same file through fscanf("%d").
+--------------------------------------------------------------------*/
+
+// Structure of a BST node (as in 06_binarySearchTree.c)
+struct Node {
+    int data;
+    struct Node* left;
+    struct Node* right;
+};
+
+double nowSeconds() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+long fileSize(const char* path) {
+    struct stat info;
+    return stat(path, &info) == 0 ? (long)info.st_size : 0;
+}
+
+/* ------------------------ TEST FILES ------------------------ */
+
+// Writes the decimal digits of 'value' ending just before 'end' and
+// returns where they start (fprintf is too slow for 100M values)
+char* formatInt(char* end, int value) {
+    unsigned u = value < 0 ? 0u - (unsigned)value : (unsigned)value;
+
+    do {
+        *--end = (char)('0' + u % 10);
+        u /= 10;
+    } while (u != 0);
+    if (value < 0)
+        *--end = '-';
+    return end;
+}
+
+// Writes 'n' random values in [-range, range] (or [0, range] if
+// 'positive') as text, one per line, or as raw ints
+int generateFile(const char* path, long n, int format, int range, int positive) {
+    FILE* out = fopen(path, "wb");
+    static char buffer[1 << 16];
+    int values[1024];
+    size_t used = 0;
+    long i;
+
+    if (out == NULL) {
+        printf("Cannot create file '%s'.\n", path);
+        return 0;
+    }
+
+    for (i = 0; i < n; i++) {
+        long r = ((long)rand() << 16 ^ rand()) % ((long)range + 1);
+        int value = (int)(positive || rand() % 2 ? r : -r);
+
+        if (format == FORMAT_BINARY) {
+            values[i % 1024] = value;
+            if (i % 1024 == 1023 || i == n - 1)
+                fwrite(values, sizeof(int), i % 1024 + 1, out);
+        } else {
+            char digits[16];
+            char* start = formatInt(digits + sizeof(digits) - 1, value);
+            digits[sizeof(digits) - 1] = '\n';
+            size_t len = digits + sizeof(digits) - start;
+
+            if (used + len > sizeof(buffer)) {
+                fwrite(buffer, 1, used, out);
+                used = 0;
+            }
+            memcpy(buffer + used, start, len);
+            used += len;
+        }
+    }
+    fwrite(buffer, 1, used, out);
+    fclose(out);
+    return 1;
+}
+
+/* -------------------------- SINKS -------------------------- */
+
+struct Summary {
+    long long count;
+    long long sum;
+    int min, max;
+};
+
+void summarySink(const int* values, size_t count, void* ctx) {
+    struct Summary* s = (struct Summary*)ctx;
+    size_t i;
+
+    for (i = 0; i < count; i++) {
+        if (s->count + (long long)i == 0 || values[i] < s->min)
+            s->min = values[i];
+        if (s->count + (long long)i == 0 || values[i] > s->max)
+            s->max = values[i];
+        s->sum += values[i];
+    }
+    s->count += count;
+}
+
+// Growable array that takes whole batches at a time
+struct IntArray {
+    int* items;
+    size_t size, capacity;
+};
+
+void arraySink(const int* values, size_t count, void* ctx) {
+    struct IntArray* a = (struct IntArray*)ctx;
+
+    if (a->size + count > a->capacity) {
+        while (a->size + count > a->capacity)
+            a->capacity = a->capacity ? 2 * a->capacity : 1024;
+        a->items = (int*)realloc(a->items, a->capacity * sizeof(int));
+    }
+    memcpy(a->items + a->size, values, count * sizeof(int));
+    a->size += count;
+}
+
+/* ---------------------- BST BULK BUILD ---------------------- */
+
+int compareInts(const void* a, const void* b) {
+    int x = *(const int*)a, y = *(const int*)b;
+    return (x > y) - (x < y);
+}
+
+// Builds a balanced BST from sorted, distinct items[lo, hi).
+// All nodes come from one block, so the tree is freed with one free().
+struct Node* buildBalanced(const int* items, long lo, long hi, struct Node** block) {
+    if (lo >= hi)
+        return NULL;
+
+    long mid = lo + (hi - lo) / 2;
+    struct Node* node = (*block)++;
+    node->data = items[mid];
+    node->left = buildBalanced(items, lo, mid, block);
+    node->right = buildBalanced(items, mid + 1, hi, block);
+    return node;
+}
+
+int treeHeight(struct Node* root) {
+    if (root == NULL)
+        return 0;
+    int lh = treeHeight(root->left);
+    int rh = treeHeight(root->right);
+    return 1 + (lh > rh ? lh : rh);
+}
+
+void loadIntoBST(const char* path, int format) {
+    struct IntArray a = { NULL, 0, 0 };
+    long long loaded;
+    size_t i, unique = 0;
+    double start = nowSeconds(), parsed, built;
+
+    loaded = loadIntegers(path, format, arraySink, &a);
+    if (loaded < 0)
+        return;
+    parsed = nowSeconds();
+
+    // Sort, drop duplicates (a BST keeps each value once), build
+    qsort(a.items, a.size, sizeof(int), compareInts);
+    for (i = 0; i < a.size; i++)
+        if (unique == 0 || a.items[i] != a.items[unique - 1])
+            a.items[unique++] = a.items[i];
+
+    struct Node* nodes = (struct Node*)malloc((unique > 0 ? unique : 1) * sizeof(struct Node));
+    struct Node* next = nodes;
+    struct Node* root = buildBalanced(a.items, 0, (long)unique, &next);
+    built = nowSeconds();
+
+    printf("Loaded %lld values in %.2f ms; sorted and built in %.2f ms.\n",
+           loaded, (parsed - start) * 1e3, (built - parsed) * 1e3);
+    printf("BST: %zu distinct values, height %d", unique, treeHeight(root));
+    if (root != NULL)
+        printf(", root %d, min %d, max %d", root->data, a.items[0], a.items[unique - 1]);
+    printf("\n");
+
+    free(nodes);
+    free(a.items);
+}
+
+/* ------------------------ BENCHMARK ------------------------ */
+
+void benchmark(const char* path, int format) {
+    struct Summary mapped = { 0, 0, 0, 0 }, scanned = { 0, 0, 0, 0 };
+    double mb = fileSize(path) / (double)(1 << 20), start, elapsed;
+    int value;
+
+    start = nowSeconds();
+    if (loadIntegers(path, format, summarySink, &mapped) < 0)
+        return;
+    elapsed = nowSeconds() - start;
+    printf("mmap loader: %10lld values, %9.2f ms, %8.1f MB/s\n",
+           mapped.count, elapsed * 1e3, mb / elapsed);
+
+    FILE* in = fopen(path, "rb");
+    start = nowSeconds();
+    if (format == FORMAT_BINARY) {
+        while (fread(&value, sizeof(int), 1, in) == 1)
+            summarySink(&value, 1, &scanned);
+    } else {
+        while (fscanf(in, "%d", &value) == 1)
+            summarySink(&value, 1, &scanned);
+    }
+    elapsed = nowSeconds() - start;
+    fclose(in);
+    printf("%-11s: %10lld values, %9.2f ms, %8.1f MB/s\n",
+           format == FORMAT_BINARY ? "fread" : "fscanf", scanned.count, elapsed * 1e3, mb / elapsed);
+
+    printf("Results %s.\n", mapped.count == scanned.count && mapped.sum == scanned.sum &&
+                            mapped.min == scanned.min && mapped.max == scanned.max
+                            ? "match" : "DIFFER");
+}
+
+// Asks for a file name and its format
+int readFileChoice(char* path, int* format) {
+    printf("Enter file name: ");
+    if (scanf("%255s", path) != 1)
+        return 0;
+    printf("Format (0 = text, 1 = binary): ");
+    scanf("%d", format);
+    *format = *format == 1 ? FORMAT_BINARY : FORMAT_TEXT;
+    return 1;
+}
+
+// MAIN FUNCTION — Menu-driven program
+int main() {
+    char path[PATH_LENGTH];
+    int choice, format, range, positive;
+    long n;
+    struct Summary s;
+    long long loaded;
+    double start;
+
+    srand((unsigned)time(NULL));
+
+    while (1) {
+        printf("\n--- BULK INTEGER LOADER ---\n");
+        printf("1. Generate Test File\n");
+        printf("2. Load File and Summarize\n");
+        printf("3. Load File into a Balanced BST\n");
+        printf("4. Benchmark against fscanf / fread\n");
+        printf("5. Exit\n");
+        printf("Enter your choice: ");
+        if (scanf("%d", &choice) != 1)
+            break;
+
+        switch (choice) {
+            case 1:
+                if (!readFileChoice(path, &format))
+                    break;
+                printf("Enter number of values, largest value, and 1 for positive only: ");
+                scanf("%ld %d %d", &n, &range, &positive);
+                if (n < 0 || range < 0) {
+                    printf("Count and largest value must not be negative.\n");
+                    break;
+                }
+                if (generateFile(path, n, format, range, positive))
+                    printf("Wrote %ld values (%.2f MB) to '%s'.\n", n,
+                           fileSize(path) / (double)(1 << 20), path);
+                break;
+
+            case 2:
+                if (!readFileChoice(path, &format))
+                    break;
+                memset(&s, 0, sizeof(s));
+                start = nowSeconds();
+                loaded = loadIntegers(path, format, summarySink, &s);
+                if (loaded < 0)
+                    break;
+                printf("Loaded %lld values in %.2f ms.\n", loaded, (nowSeconds() - start) * 1e3);
+                if (loaded > 0)
+                    printf("Sum: %lld, Min: %d, Max: %d\n", s.sum, s.min, s.max);
+                break;
+
+            case 3:
+                if (readFileChoice(path, &format))
+                    loadIntoBST(path, format);
+                break;
+
+            case 4:
+                if (readFileChoice(path, &format))
+                    benchmark(path, format);
+                break;
+
+            case 5:
+                printf("Exiting program...\n");
+                exit(0);
+
+            default:
+                printf("Invalid choice! Try again.\n");
+        }
+    }
+
+    return 0;
+}
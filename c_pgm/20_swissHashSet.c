@@ -0,0 +1,506 @@
+#define _DEFAULT_SOURCE  // clock_gettime also under -std=c11
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <time.h>
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+#define GROUP_WIDTH 16        // Metadata bytes tested at once
+#define MIN_CAPACITY 16       // Must be at least GROUP_WIDTH
+#define EMPTY 0x80            // Metadata of an empty slot
+#define MIGRATE_STEP 16       // Old slots moved per operation while resizing
+
+/* ----------------------- SWISS HASH SET -----------------------
+   An unordered set of ints, for the membership checks that the
+   BST of 06_binarySearchTree.c answers in O(log n) pointer steps.
+
+   Open addressing with linear probing: a value lives in the first
+   free slot at or after its HOME slot. Next to the 'keys' array is
+   one METADATA byte per slot: EMPTY (0x80), or 7 bits of the
+   value's hash (its TAG). A lookup loads the 16 metadata bytes
+   from its home slot and, with two SSE2 instructions, gets
+       - which of the 16 slots have the same tag, and
+       - which are empty.
+   Only slots with the right tag before the first empty one are
+   compared, so most lookups look at one key.
+
+   DELETE leaves no tombstones: later values of the same run are
+   shifted back into the hole ("backward shift"), like the hash
+   index of 09_lruCache.c.
+
+   RESIZE is incremental: when the table is 7/8 full a twice-as-big
+   table is made, and every operation moves the next MIGRATE_STEP
+   slots of the old table into it. Until that is done, lookups
+   check both tables.
+------------------------------------------------------------------*/
+
+struct Table {
+    int* keys;                // Values
+    unsigned char* ctrl;      // Metadata, plus a copy of the first
+                              // GROUP_WIDTH bytes at the end so a group
+                              // load never wraps around
+    size_t mask;              // Capacity - 1 (capacity is a power of two)
+    int shift;                // 64 - log2(capacity)
+    size_t count;             // Values in this table
+};
+
+struct HashSet {
+    struct Table table;       // Where new values go
+    struct Table old;         // Table being emptied while resizing
+    int resizing;             // 1 while 'old' still holds values
+    size_t cursor;            // Old slots below this one are all empty
+};
+
+/* ------------------------ ONE TABLE ------------------------ */
+
+uint64_t hashValue(int value) {
+    return (uint64_t)(uint32_t)value * 0x9E3779B97F4A7C15ULL;   // Fibonacci hashing
+}
+
+// Home slot: the top bits of the hash
+size_t homeSlot(struct Table* t, uint64_t h) {
+    return (size_t)(h >> t->shift);
+}
+
+// Tag: the 7 bits just below the home bits
+unsigned char tagOf(struct Table* t, uint64_t h) {
+    return (unsigned char)((h >> (t->shift - 7)) & 0x7F);
+}
+
+void createTable(struct Table* t, size_t capacity) {
+    int bits = 0;
+
+    while (((size_t)1 << bits) < capacity)
+        bits++;
+    t->mask = capacity - 1;
+    t->shift = 64 - bits;
+    t->count = 0;
+    t->keys = (int*)malloc(capacity * sizeof(int));
+    t->ctrl = (unsigned char*)malloc(capacity + GROUP_WIDTH);
+    memset(t->ctrl, EMPTY, capacity + GROUP_WIDTH);
+}
+
+void freeTable(struct Table* t) {
+    free(t->keys);
+    free(t->ctrl);
+    t->keys = NULL;
+    t->ctrl = NULL;
+    t->count = 0;
+}
+
+// Sets a metadata byte and its copy past the end
+void setCtrl(struct Table* t, size_t slot, unsigned char c) {
+    t->ctrl[slot] = c;
+    if (slot < GROUP_WIDTH)
+        t->ctrl[t->mask + 1 + slot] = c;
+}
+
+// For the 16 slots from 'slot': bit i of *match is set if slot + i
+// has tag 'tag', bit i of *empty if slot + i is empty
+void probeGroup(struct Table* t, size_t slot, unsigned char tag, unsigned* match, unsigned* empty) {
+#ifdef __SSE2__
+    __m128i group = _mm_loadu_si128((const __m128i*)(t->ctrl + slot));
+    *match = (unsigned)_mm_movemask_epi8(_mm_cmpeq_epi8(group, _mm_set1_epi8((char)tag)));
+    *empty = (unsigned)_mm_movemask_epi8(group);   // EMPTY is the only byte with the high bit
+#else
+    int i;
+    *match = *empty = 0;
+    for (i = 0; i < GROUP_WIDTH; i++) {
+        if (t->ctrl[slot + i] == tag)
+            *match |= 1u << i;
+        if (t->ctrl[slot + i] == EMPTY)
+            *empty |= 1u << i;
+    }
+#endif
+}
+
+// Returns the slot holding 'value', or -1
+long findSlot(struct Table* t, int value) {
+    uint64_t h = hashValue(value);
+    size_t slot = homeSlot(t, h);
+    unsigned char tag = tagOf(t, h);
+    unsigned match, empty;
+
+    while (1) {
+        probeGroup(t, slot, tag, &match, &empty);
+
+        // A run of values ends at the first empty slot
+        if (empty != 0)
+            match &= (empty & (0u - empty)) - 1;
+
+        while (match != 0) {
+            size_t i = (slot + (size_t)__builtin_ctz(match)) & t->mask;
+            if (t->keys[i] == value)
+                return (long)i;
+            match &= match - 1;
+        }
+        if (empty != 0)
+            return -1;
+        slot = (slot + GROUP_WIDTH) & t->mask;
+    }
+}
+
+// Puts a value that is not in the table into its first free slot
+void tableInsert(struct Table* t, int value) {
+    uint64_t h = hashValue(value);
+    size_t slot = homeSlot(t, h);
+    unsigned match, empty;
+
+    while (1) {
+        probeGroup(t, slot, EMPTY, &match, &empty);
+        if (empty != 0) {
+            slot = (slot + (size_t)__builtin_ctz(empty)) & t->mask;
+            break;
+        }
+        slot = (slot + GROUP_WIDTH) & t->mask;
+    }
+
+    t->keys[slot] = value;
+    setCtrl(t, slot, tagOf(t, h));
+    t->count++;
+}
+
+// Empties a slot and shifts back the values that follow it, so
+// lookups never need tombstones
+void tableRemoveAt(struct Table* t, size_t hole) {
+    size_t i = (hole + 1) & t->mask;
+
+    while (t->ctrl[i] != EMPTY) {
+        size_t home = homeSlot(t, hashValue(t->keys[i]));
+        // Value may fill the hole if its home is not in (hole, i]
+        if (((i - home) & t->mask) >= ((i - hole) & t->mask)) {
+            t->keys[hole] = t->keys[i];
+            setCtrl(t, hole, t->ctrl[i]);
+            hole = i;
+        }
+        i = (i + 1) & t->mask;
+    }
+    setCtrl(t, hole, EMPTY);
+    t->count--;
+}
+
+/* ------------------------ THE SET ------------------------ */
+
+void createSet(struct HashSet* set) {
+    createTable(&set->table, MIN_CAPACITY);
+    set->resizing = 0;
+    set->cursor = 0;
+}
+
+void destroySet(struct HashSet* set) {
+    freeTable(&set->table);
+    if (set->resizing)
+        freeTable(&set->old);
+}
+
+size_t setSize(struct HashSet* set) {
+    return set->table.count + (set->resizing ? set->old.count : 0);
+}
+
+// Moves up to 'steps' old slots into the new table. Taking a value
+// out of the old table may shift a later one back into the cursor
+// slot, so a slot is only passed once it is empty. Old slots below
+// the cursor are then always empty.
+void migrate(struct HashSet* set, size_t steps) {
+    struct Table* old = &set->old;
+
+    while (set->resizing && steps-- > 0) {
+        while (old->ctrl[set->cursor] != EMPTY) {
+            tableInsert(&set->table, old->keys[set->cursor]);
+            tableRemoveAt(old, set->cursor);
+        }
+        set->cursor++;
+        if (set->cursor > old->mask) {
+            freeTable(old);
+            set->resizing = 0;
+        }
+    }
+}
+
+// Starts moving to a table twice the size once this one is 7/8 full
+void growIfNeeded(struct HashSet* set) {
+    size_t capacity = set->table.mask + 1;
+
+    if (set->table.count + 1 <= capacity - capacity / 8)
+        return;
+
+    // A resize still running is finished first
+    migrate(set, (size_t)-1);
+
+    set->old = set->table;
+    createTable(&set->table, 2 * capacity);
+    set->resizing = 1;
+    set->cursor = 0;
+}
+
+int searchValue(struct HashSet* set, int value) {
+    migrate(set, MIGRATE_STEP);
+    if (findSlot(&set->table, value) >= 0)
+        return 1;
+    return set->resizing && findSlot(&set->old, value) >= 0;
+}
+
+// Function to insert a value. Duplicates are ignored, as in the BST.
+void insertValue(struct HashSet* set, int value) {
+    if (searchValue(set, value)) {
+        printf("Duplicate value! Ignored.\n");
+        return;
+    }
+    growIfNeeded(set);
+    tableInsert(&set->table, value);
+}
+
+// Function to delete a value from whichever table holds it
+void deleteValue(struct HashSet* set, int value) {
+    long slot;
+
+    migrate(set, MIGRATE_STEP);
+    if ((slot = findSlot(&set->table, value)) >= 0) {
+        tableRemoveAt(&set->table, (size_t)slot);
+    } else if (set->resizing && (slot = findSlot(&set->old, value)) >= 0) {
+        tableRemoveAt(&set->old, (size_t)slot);
+    } else {
+        printf("Value not found.\n");
+        return;
+    }
+    printf("Value %d deleted.\n", value);
+}
+
+// Prints every value in slot order (which is no particular order)
+void displaySet(struct HashSet* set) {
+    size_t i;
+
+    if (setSize(set) == 0) {
+        printf("Set is empty.\n");
+        return;
+    }
+
+    printf("Hash Set (unordered): ");
+    if (set->resizing)
+        for (i = set->cursor; i <= set->old.mask; i++)
+            if (set->old.ctrl[i] != EMPTY)
+                printf("%d ", set->old.keys[i]);
+    for (i = 0; i <= set->table.mask; i++)
+        if (set->table.ctrl[i] != EMPTY)
+            printf("%d ", set->table.keys[i]);
+    printf("\n");
+}
+
+void showStats(struct HashSet* set) {
+    size_t capacity = set->table.mask + 1;
+
+    printf("Values: %zu, capacity: %zu, load: %.1f%%, %s\n", setSize(set), capacity,
+           100.0 * set->table.count / capacity,
+           set->resizing ? "resizing" : "not resizing");
+    if (set->resizing)
+        printf("Old table: %zu values left, %zu of %zu slots moved\n",
+               set->old.count, set->cursor, set->old.mask + 1);
+    printf("Group probing: %s\n",
+#ifdef __SSE2__
+           "SSE2"
+#else
+           "scalar"
+#endif
+           );
+}
+
+/* ------------------------ BENCHMARK ------------------------
+   n random inserts, then n lookups of present values and n of
+   absent ones, then n deletes: on the hash set and on a BST as in
+   06 (iterative, no recursion overhead).
+------------------------------------------------------------*/
+
+struct Node {
+    int data;
+    struct Node* left;
+    struct Node* right;
+};
+
+double nowSeconds() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+int bstInsert(struct Node** root, int value) {
+    struct Node** link = root;
+
+    while (*link != NULL) {
+        if (value == (*link)->data)
+            return 0;
+        link = value < (*link)->data ? &(*link)->left : &(*link)->right;
+    }
+    *link = (struct Node*)malloc(sizeof(struct Node));
+    (*link)->data = value;
+    (*link)->left = (*link)->right = NULL;
+    return 1;
+}
+
+int bstSearch(struct Node* root, int value) {
+    while (root != NULL && root->data != value)
+        root = value < root->data ? root->left : root->right;
+    return root != NULL;
+}
+
+void bstDelete(struct Node** root, int value) {
+    struct Node** link = root;
+    struct Node* node;
+
+    while (*link != NULL && (*link)->data != value)
+        link = value < (*link)->data ? &(*link)->left : &(*link)->right;
+    if ((node = *link) == NULL)
+        return;
+
+    if (node->left == NULL) {
+        *link = node->right;
+    } else if (node->right == NULL) {
+        *link = node->left;
+    } else {
+        struct Node** succ = &node->right;
+        while ((*succ)->left != NULL)
+            succ = &(*succ)->left;
+        struct Node* s = *succ;
+        *succ = s->right;
+        s->left = node->left;
+        s->right = node->right;
+        *link = s;
+    }
+    free(node);
+}
+
+void runBenchmark(int n) {
+    int* values = (int*)malloc(n * sizeof(int));
+    struct HashSet set;
+    struct Node* root = NULL;
+    double start, t[4];
+    long found;
+    int i;
+
+    // Even values are inserted; odd ones are the misses
+    for (i = 0; i < n; i++)
+        values[i] = 2 * (int)(((unsigned)rand() << 8 ^ (unsigned)rand()) & 0x3FFFFFFF);
+
+    printf("%d values:          insert     hit      miss     delete   (ms)\n", n);
+
+    createSet(&set);
+    start = nowSeconds();
+    for (i = 0; i < n; i++)
+        if (!searchValue(&set, values[i])) {
+            growIfNeeded(&set);
+            tableInsert(&set.table, values[i]);
+        }
+    t[0] = nowSeconds();
+    for (found = 0, i = 0; i < n; i++)
+        found += searchValue(&set, values[i]);
+    t[1] = nowSeconds();
+    for (i = 0; i < n; i++)
+        found += searchValue(&set, values[i] + 1);
+    t[2] = nowSeconds();
+    for (i = 0; i < n; i++) {
+        long slot;
+        migrate(&set, MIGRATE_STEP);
+        if ((slot = findSlot(&set.table, values[i])) >= 0)
+            tableRemoveAt(&set.table, (size_t)slot);
+        else if (set.resizing && (slot = findSlot(&set.old, values[i])) >= 0)
+            tableRemoveAt(&set.old, (size_t)slot);
+    }
+    t[3] = nowSeconds();
+    printf("Swiss hash set:  %8.2f %8.2f %8.2f %8.2f   (found %ld, left %zu)\n",
+           (t[0] - start) * 1e3, (t[1] - t[0]) * 1e3, (t[2] - t[1]) * 1e3, (t[3] - t[2]) * 1e3,
+           found, setSize(&set));
+    destroySet(&set);
+
+    start = nowSeconds();
+    for (i = 0; i < n; i++)
+        bstInsert(&root, values[i]);
+    t[0] = nowSeconds();
+    for (found = 0, i = 0; i < n; i++)
+        found += bstSearch(root, values[i]);
+    t[1] = nowSeconds();
+    for (i = 0; i < n; i++)
+        found += bstSearch(root, values[i] + 1);
+    t[2] = nowSeconds();
+    for (i = 0; i < n; i++)
+        bstDelete(&root, values[i]);
+    t[3] = nowSeconds();
+    printf("BST:             %8.2f %8.2f %8.2f %8.2f   (found %ld, left %s)\n",
+           (t[0] - start) * 1e3, (t[1] - t[0]) * 1e3, (t[2] - t[1]) * 1e3, (t[3] - t[2]) * 1e3,
+           found, root == NULL ? "0" : "some");
+
+    free(values);
+}
+
+// MAIN FUNCTION — Menu-driven program
+int main() {
+    struct HashSet set;
+    int choice, value;
+
+    srand((unsigned)time(NULL));
+    createSet(&set);
+
+    while (1) {
+        printf("\n--- SWISS HASH SET OPERATIONS ---\n");
+        printf("1. Insert Value\n");
+        printf("2. Delete Value\n");
+        printf("3. Search Value\n");
+        printf("4. Display Set\n");
+        printf("5. Show Size and Load\n");
+        printf("6. Benchmark against BST\n");
+        printf("7. Exit\n");
+        printf("Enter your choice: ");
+        scanf("%d", &choice);
+
+        switch (choice) {
+            case 1:
+                printf("Enter value to insert: ");
+                scanf("%d", &value);
+                insertValue(&set, value);
+                break;
+
+            case 2:
+                printf("Enter value to delete: ");
+                scanf("%d", &value);
+                deleteValue(&set, value);
+                break;
+
+            case 3:
+                printf("Enter value to search: ");
+                scanf("%d", &value);
+                if (searchValue(&set, value))
+                    printf("Value %d found in set.\n", value);
+                else
+                    printf("Value %d not found.\n", value);
+                break;
+
+            case 4:
+                displaySet(&set);
+                break;
+
+            case 5:
+                showStats(&set);
+                break;
+
+            case 6:
+                printf("Enter number of values: ");
+                scanf("%d", &value);
+                if (value < 1)
+                    printf("Nothing to benchmark.\n");
+                else
+                    runBenchmark(value);
+                break;
+
+            case 7:
+                printf("Exiting program...\n");
+                destroySet(&set);
+                exit(0);
+
+            default:
+                printf("Invalid choice! Try again.\n");
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,525 @@
+// Compile with: gcc -O2 -pthread 21_treap.c -o treap
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "threadpool.h"
+
+#define SPAWN_DEPTH 8       // Set operations fork tasks only in the top levels
+
+/* --------------------------- TREAP ---------------------------
+   The BST of 06_binarySearchTree.c kept balanced by giving every
+   node a PRIORITY and keeping the tree a heap on it (no node has
+   a higher priority than its parent). With random priorities the
+   expected height is O(log n), whatever order values come in.
+   Here the priority is a hash of the value, so the same set of
+   values always gives the same tree and threads need no shared
+   random generator.
+
+   Two primitives do all the work, both in O(log n):
+     split(root, key) -> (values < key, values > key)
+         and the node equal to key, if there is one
+     join(left, right)  every value of left < every value of right
+   Insert is split + join with the new node, delete is split and
+   join of the two sides.
+
+   Bulk operations work on whole trees: union, intersection and
+   difference split the second tree at the root of the first and
+   recurse on the two halves. The halves share no nodes, so the two
+   recursive calls run in parallel on the thread pool of
+   threadpool.h. A bulk insert builds a treap of the new values
+   (sorted, in O(n)) and unions it in; a bulk delete subtracts one.
+---------------------------------------------------------------*/
+
+// Structure of a treap node
+struct Node {
+    int data;              // Data value of the node
+    unsigned priority;     // Heap key (hash of data)
+    struct Node* left;     // Pointer to the left child
+    struct Node* right;    // Pointer to the right child
+};
+
+double nowSeconds() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// Priority of a value: a well-mixed hash of it
+unsigned priorityOf(int value) {
+    unsigned x = (unsigned)value;
+    x ^= x >> 16;
+    x *= 0x7FEB352Du;
+    x ^= x >> 15;
+    x *= 0x846CA68Bu;
+    x ^= x >> 16;
+    return x;
+}
+
+// Priority order; equal priorities are ordered by value, so no two
+// nodes ever tie
+int outranks(struct Node* a, struct Node* b) {
+    return a->priority > b->priority || (a->priority == b->priority && a->data < b->data);
+}
+
+struct Node* createNode(int value) {
+    struct Node* newNode = (struct Node*)malloc(sizeof(struct Node));
+    newNode->data = value;
+    newNode->priority = priorityOf(value);
+    newNode->left = NULL;
+    newNode->right = NULL;
+    return newNode;
+}
+
+void freeTree(struct Node* root) {
+    if (root == NULL)
+        return;
+    freeTree(root->left);
+    freeTree(root->right);
+    free(root);
+}
+
+/* ------------------------ SPLIT / JOIN ------------------------ */
+
+// Cuts the tree into *left (values < key) and *right (values > key).
+// Returns the node holding key, taken out of both, or NULL.
+struct Node* split(struct Node* root, int key, struct Node** left, struct Node** right) {
+    struct Node* found;
+
+    if (root == NULL) {
+        *left = *right = NULL;
+        return NULL;
+    }
+
+    if (key == root->data) {
+        *left = root->left;
+        *right = root->right;
+        root->left = root->right = NULL;
+        return root;
+    }
+
+    if (key < root->data) {
+        // Root and its right subtree go right; split the left subtree
+        found = split(root->left, key, left, &root->left);
+        *right = root;
+    } else {
+        found = split(root->right, key, &root->right, right);
+        *left = root;
+    }
+    return found;
+}
+
+// Joins two treaps where every value of 'left' is smaller than every
+// value of 'right'. The root with the higher priority stays on top.
+struct Node* join(struct Node* left, struct Node* right) {
+    if (left == NULL)
+        return right;
+    if (right == NULL)
+        return left;
+
+    if (outranks(left, right)) {
+        left->right = join(left->right, right);
+        return left;
+    }
+    right->left = join(left, right->left);
+    return right;
+}
+
+/* ---------------------- SINGLE VALUES ---------------------- */
+
+// Duplicates are ignored, as in the BST
+struct Node* insertNode(struct Node* root, int value) {
+    struct Node *left, *right;
+    struct Node* found = split(root, value, &left, &right);
+
+    if (found != NULL) {
+        printf("Duplicate value! Ignored.\n");
+    } else {
+        found = createNode(value);
+    }
+    return join(join(left, found), right);
+}
+
+struct Node* deleteNode(struct Node* root, int value) {
+    struct Node *left, *right;
+    struct Node* found = split(root, value, &left, &right);
+
+    if (found == NULL)
+        printf("Value not found.\n");
+    else
+        printf("Value %d deleted.\n", value);
+    free(found);
+    return join(left, right);
+}
+
+struct Node* searchNode(struct Node* root, int value) {
+    while (root != NULL && root->data != value)
+        root = value < root->data ? root->left : root->right;
+    return root;
+}
+
+/* --------------------- SET OPERATIONS ---------------------
+   All three take two trees and return the result tree. The nodes
+   of both inputs are reused or freed, so neither input may be used
+   afterwards. The expected cost is O(m log(n / m + 1)) for trees of
+   m <= n values, which is O(log n) per value in the smaller tree.
+------------------------------------------------------------*/
+
+enum SetOp { SET_UNION, SET_INTERSECT, SET_DIFFERENCE };
+
+struct SetJob {
+    struct ThreadPool* pool;  // NULL: run sequentially
+    enum SetOp op;
+    struct Node* a;
+    struct Node* b;
+    int depth;
+    struct Node* result;
+};
+
+void setTask(void* arg);
+
+// Runs the same operation on the two halves, the left one as a task
+// near the root of the recursion, then returns both results
+void setHalves(struct SetJob* job, struct Node* a1, struct Node* b1, struct Node* a2, struct Node* b2,
+               struct Node** r1, struct Node** r2) {
+    struct SetJob left = { job->pool, job->op, a1, b1, job->depth + 1, NULL };
+    struct SetJob right = { job->pool, job->op, a2, b2, job->depth + 1, NULL };
+
+    if (job->pool != NULL && job->depth < SPAWN_DEPTH) {
+        struct TaskGroup group;
+        struct Task task;
+
+        taskGroupInit(&group);
+        taskSpawn(job->pool, &task, setTask, &left, &group);
+        setTask(&right);
+        taskWait(job->pool, &group);
+    } else {
+        setTask(&left);
+        setTask(&right);
+    }
+    *r1 = left.result;
+    *r2 = right.result;
+}
+
+void setTask(void* arg) {
+    struct SetJob* job = (struct SetJob*)arg;
+    struct Node* a = job->a;
+    struct Node* b = job->b;
+    struct Node *bl, *br, *dup, *l, *r;
+
+    // Empty inputs
+    if (a == NULL || b == NULL) {
+        if (job->op == SET_UNION) {
+            job->result = a != NULL ? a : b;
+        } else if (job->op == SET_INTERSECT) {
+            freeTree(a);
+            freeTree(b);
+            job->result = NULL;
+        } else {
+            freeTree(b);
+            job->result = a;
+        }
+        return;
+    }
+
+    // Union and intersection are symmetric: keep the root with the
+    // higher priority on top so the result stays a heap
+    if (job->op != SET_DIFFERENCE && outranks(b, a)) {
+        struct Node* t = a;
+        a = b;
+        b = t;
+    }
+
+    dup = split(b, a->data, &bl, &br);
+    setHalves(job, a->left, bl, a->right, br, &l, &r);
+
+    if (job->op == SET_UNION || (job->op == SET_INTERSECT) == (dup != NULL)) {
+        // a's root stays in the result
+        free(dup);
+        a->left = l;
+        a->right = r;
+        job->result = a;
+    } else {
+        // a's root is left out
+        free(dup);
+        free(a);
+        job->result = join(l, r);
+    }
+}
+
+struct Node* setOperation(struct ThreadPool* pool, enum SetOp op, struct Node* a, struct Node* b) {
+    struct SetJob job = { pool, op, a, b, 0, NULL };
+
+    if (pool != NULL)
+        poolRun(pool, setTask, &job);
+    else
+        setTask(&job);
+    return job.result;
+}
+
+// Values in a or in b
+struct Node* treapUnion(struct ThreadPool* pool, struct Node* a, struct Node* b) {
+    return setOperation(pool, SET_UNION, a, b);
+}
+
+// Values in both a and b
+struct Node* treapIntersect(struct ThreadPool* pool, struct Node* a, struct Node* b) {
+    return setOperation(pool, SET_INTERSECT, a, b);
+}
+
+// Values in a but not in b
+struct Node* treapDifference(struct ThreadPool* pool, struct Node* a, struct Node* b) {
+    return setOperation(pool, SET_DIFFERENCE, a, b);
+}
+
+/* ---------------------- BULK BUILD ---------------------- */
+
+int compareInts(const void* a, const void* b) {
+    int x = *(const int*)a, y = *(const int*)b;
+    return (x > y) - (x < y);
+}
+
+// Builds the treap of 'n' values in O(n log n) for the sort and O(n)
+// for the tree. Values come in sorted order, so each new node goes
+// on the right spine: nodes of lower priority on that spine become
+// its left subtree.
+struct Node* buildTreap(int* values, long n) {
+    struct Node** spine = (struct Node**)malloc((n > 0 ? n : 1) * sizeof(struct Node*));
+    long top = 0, i;
+    struct Node* root;
+
+    qsort(values, n, sizeof(int), compareInts);
+    for (i = 0; i < n; i++) {
+        struct Node* node;
+        struct Node* last = NULL;
+
+        if (i > 0 && values[i] == values[i - 1])
+            continue;   // Duplicates are ignored
+
+        node = createNode(values[i]);
+        while (top > 0 && outranks(node, spine[top - 1]))
+            last = spine[--top];
+        node->left = last;
+        if (top > 0)
+            spine[top - 1]->right = node;
+        spine[top++] = node;
+    }
+
+    root = top > 0 ? spine[0] : NULL;
+    free(spine);
+    return root;
+}
+
+// Reads 'n' values and builds their treap
+struct Node* readTreap(int n) {
+    int* values = (int*)malloc((n > 0 ? n : 1) * sizeof(int));
+    struct Node* root;
+    int i;
+
+    printf("Enter %d values: ", n);
+    for (i = 0; i < n; i++)
+        scanf("%d", &values[i]);
+    root = buildTreap(values, n);
+    free(values);
+    return root;
+}
+
+/* ------------------------- DISPLAY ------------------------- */
+
+void inorder(struct Node* root) {
+    if (root == NULL)
+        return;
+    inorder(root->left);
+    printf("%d ", root->data);
+    inorder(root->right);
+}
+
+int treeHeight(struct Node* root) {
+    if (root == NULL)
+        return 0;
+    int lh = treeHeight(root->left);
+    int rh = treeHeight(root->right);
+    return 1 + (lh > rh ? lh : rh);
+}
+
+long countNodes(struct Node* root) {
+    return root == NULL ? 0 : 1 + countNodes(root->left) + countNodes(root->right);
+}
+
+void showTree(const char* label, struct Node* root) {
+    printf("%s (%ld values, height %d): ", label, countNodes(root), treeHeight(root));
+    inorder(root);
+    printf("\n");
+}
+
+/* ------------------------ BENCHMARK ------------------------
+   A tree of n random values gets m more: inserted one at a time,
+   and unioned in as one treap, sequentially and on the pool.
+------------------------------------------------------------*/
+
+// Random values; the same seed gives the same values
+int* randomValues(long n, unsigned seed) {
+    int* values = (int*)malloc((n > 0 ? n : 1) * sizeof(int));
+    long i;
+
+    srand(seed);
+    for (i = 0; i < n; i++)
+        values[i] = (int)(((unsigned)rand() << 16 ^ (unsigned)rand()) & 0x7FFFFFFF);
+    return values;
+}
+
+// Order-dependent checksum of the inorder walk
+unsigned long long checksum(struct Node* root, unsigned long long h) {
+    if (root == NULL)
+        return h;
+    h = checksum(root->left, h);
+    h = (h ^ (unsigned)root->data) * 1099511628211ULL;
+    return checksum(root->right, h);
+}
+
+void runBenchmark(struct ThreadPool* pool, long n, long m) {
+    int* base = randomValues(n, 1);
+    int* extra = randomValues(m, 2);
+    int* copy = (int*)malloc(m * sizeof(int));
+    struct Node *tree, *more;
+    unsigned long long sums[3];
+    double start, times[3];
+    long i;
+
+    // One insert per value (split + join each time)
+    tree = buildTreap(base, n);
+    start = nowSeconds();
+    for (i = 0; i < m; i++) {
+        struct Node *left, *right;
+        struct Node* found = split(tree, extra[i], &left, &right);
+        tree = join(join(left, found != NULL ? found : createNode(extra[i])), right);
+    }
+    times[0] = nowSeconds() - start;
+    sums[0] = checksum(tree, 14695981039346656037ULL);
+    freeTree(tree);
+
+    // Bulk: build a treap of the new values, then one union
+    for (i = 1; i <= 2; i++) {
+        tree = buildTreap(base, n);
+        memcpy(copy, extra, m * sizeof(int));   // buildTreap sorts its input
+        start = nowSeconds();
+        more = buildTreap(copy, m);
+        tree = treapUnion(i == 1 ? NULL : pool, tree, more);
+        times[i] = nowSeconds() - start;
+        sums[i] = checksum(tree, 14695981039346656037ULL);
+        freeTree(tree);
+    }
+
+    printf("Adding %ld values to a treap of %ld:\n", m, n);
+    printf("One insert per value:      %9.2f ms\n", times[0] * 1e3);
+    printf("Bulk union, sequential:    %9.2f ms\n", times[1] * 1e3);
+    printf("Bulk union, %2d worker(s): %9.2f ms  speed-up %.2fx over sequential union\n",
+           pool->size, times[2] * 1e3, times[1] / times[2]);
+    printf("Results %s.\n", sums[0] == sums[1] && sums[1] == sums[2] ? "match" : "DIFFER");
+
+    free(base);
+    free(extra);
+    free(copy);
+}
+
+// MAIN FUNCTION — Menu-driven program
+int main() {
+    struct ThreadPool pool;
+    struct Node* root = NULL;
+    struct Node *left, *right, *found, *other;
+    int choice, value, n, m;
+
+    createThreadPool(&pool, 0);
+
+    while (1) {
+        printf("\n--- TREAP OPERATIONS (%d workers) ---\n", pool.size);
+        printf("1. Insert Node\n");
+        printf("2. Delete Node\n");
+        printf("3. Search Node\n");
+        printf("4. Inorder Traversal\n");
+        printf("5. Split at Value (and join back)\n");
+        printf("6. Bulk Insert (union)\n");
+        printf("7. Bulk Delete (difference)\n");
+        printf("8. Keep Only Given Values (intersection)\n");
+        printf("9. Benchmark Bulk Insert\n");
+        printf("10. Exit\n");
+        printf("Enter your choice: ");
+        if (scanf("%d", &choice) != 1)
+            break;
+
+        switch (choice) {
+            case 1:
+                printf("Enter value to insert: ");
+                scanf("%d", &value);
+                root = insertNode(root, value);
+                break;
+
+            case 2:
+                printf("Enter value to delete: ");
+                scanf("%d", &value);
+                root = deleteNode(root, value);
+                break;
+
+            case 3:
+                printf("Enter value to search: ");
+                scanf("%d", &value);
+                if (searchNode(root, value) != NULL)
+                    printf("Value %d found in treap.\n", value);
+                else
+                    printf("Value %d not found.\n", value);
+                break;
+
+            case 4:
+                showTree("Inorder Traversal", root);
+                break;
+
+            case 5:
+                printf("Enter value to split at: ");
+                scanf("%d", &value);
+                found = split(root, value, &left, &right);
+                showTree("Smaller", left);
+                printf("Value %d %s.\n", value, found != NULL ? "was in the tree" : "was not in the tree");
+                showTree("Larger", right);
+                root = join(join(left, found), right);
+                break;
+
+            // The values are built into a treap of their own, which is
+            // then combined with the tree in one set operation
+            case 6:
+            case 7:
+            case 8:
+                printf("Enter number of values: ");
+                scanf("%d", &n);
+                other = readTreap(n);
+                if (choice == 6)
+                    root = treapUnion(&pool, root, other);
+                else if (choice == 7)
+                    root = treapDifference(&pool, root, other);
+                else
+                    root = treapIntersect(&pool, root, other);
+                showTree("Result", root);
+                break;
+
+            case 9:
+                printf("Enter size of the tree and number of values to add: ");
+                scanf("%d %d", &n, &m);
+                if (n < 0 || m < 1)
+                    printf("Nothing to benchmark.\n");
+                else
+                    runBenchmark(&pool, n, m);
+                break;
+
+            case 10:
+                printf("Exiting program...\n");
+                freeTree(root);
+                destroyThreadPool(&pool);
+                exit(0);
+
+            default:
+                printf("Invalid choice! Try again.\n");
+        }
+    }
+
+    freeTree(root);
+    destroyThreadPool(&pool);
+    return 0;
+}
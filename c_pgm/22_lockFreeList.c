@@ -0,0 +1,866 @@
+// Compile with: gcc -O2 -pthread 22_lockFreeList.c -o lockFreeList
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <time.h>
+
+#define MAX_THREADS 64
+#define EPOCH_IDLE -1         // Announced epoch of a thread outside any operation
+#define RETIRE_SCAN 64        // Retired nodes between tries to advance the epoch
+#define MAX_KEY_OPS 63        // Most calls on one key between two quiet moments
+#define MAX_SKIPPED_PERCENT 1 // More unchecked keys than this and a test proves nothing
+#define CALLS_PER_KEY 32      // Default key count: about this many calls per key
+#define MEMO_SIZE (1 << 14)   // Entries in the checker's table of explored states
+
+/* ---------------------- LOCK-FREE SORTED LIST ----------------------
+   The sorted singly linked list of 01_sll.c for many threads at
+   once, without a lock (Harris's list, with Michael's way of
+   unlinking nodes in search).
+
+   Every link is an atomic word. Its lowest bit is the DELETE MARK of
+   the node that owns the link (nodes are aligned, so that bit of a
+   pointer is always free):
+
+       head -> [10 | .] -> [20 | x] -> [30 | .] -> NULL
+                             ^ 20 is deleted: its own next is marked
+
+   - insert: find the two nodes around the value and swing the
+     link between them to the new node with one CAS. The CAS fails if
+     the link changed meanwhile (or its node was marked); then the
+     search starts over.
+   - delete: first MARK the node's next link with a CAS. That is the
+     moment the value leaves the set, and no CAS can succeed on a
+     marked link, so nothing is ever inserted after a deleted node.
+     Then the node is UNLINKED by a CAS on its predecessor; if that
+     fails, whichever search meets the marked node next unlinks it.
+   - contains: walks the links without writing anything.
+
+   Reclamation (EPOCH-BASED): an unlinked node may still be read by
+   threads that were already walking over it, so it is not freed at
+   once. A global epoch counter is announced by every thread when it
+   starts an operation. An unlinked node is RETIRED into a bag tagged
+   with the current epoch. The epoch only moves from E to E + 1 when
+   every thread inside an operation has announced E, so once it has
+   moved two further every thread that could have seen the node has
+   finished, and the bag is freed.
+---------------------------------------------------------------------*/
+
+#define MARK ((uintptr_t)1)
+
+struct Node {
+    int data;                   // Never changes once the node is linked in
+    atomic_uintptr_t next;      // Next node, with this node's delete mark
+    struct Node* retiredNext;   // Link in a bag of retired nodes
+};
+
+// Per-thread epoch state (one cache line per thread, so announcing
+// does not slow down other threads)
+struct EpochThread {
+    _Alignas(64) atomic_long epoch;   // Announced epoch, or EPOCH_IDLE
+    struct Node* bag[3];              // Retired nodes, by epoch % 3
+    long bagEpoch[3];                 // Epoch each bag was filled in
+    long retires;
+};
+
+struct LockFreeList {
+    struct Node head;            // Sentinel in front of the smallest value
+    atomic_long globalEpoch;
+    atomic_int threadCount;      // Registered threads
+    atomic_long retired, freed;  // Nodes unlinked / given back to free()
+    struct EpochThread threads[MAX_THREADS];
+};
+
+struct Node* ptrOf(uintptr_t link) {
+    return (struct Node*)(link & ~MARK);
+}
+
+int isMarked(uintptr_t link) {
+    return (int)(link & MARK);
+}
+
+struct Node* createNode(int value) {
+    struct Node* newNode = (struct Node*)malloc(sizeof(struct Node));
+    newNode->data = value;
+    atomic_init(&newNode->next, (uintptr_t)0);
+    newNode->retiredNext = NULL;
+    return newNode;
+}
+
+void createList(struct LockFreeList* list) {
+    int i, j;
+
+    atomic_init(&list->head.next, (uintptr_t)0);
+    atomic_init(&list->globalEpoch, 0);
+    atomic_init(&list->threadCount, 0);
+    atomic_init(&list->retired, 0);
+    atomic_init(&list->freed, 0);
+    for (i = 0; i < MAX_THREADS; i++) {
+        atomic_init(&list->threads[i].epoch, EPOCH_IDLE);
+        for (j = 0; j < 3; j++) {
+            list->threads[i].bag[j] = NULL;
+            list->threads[i].bagEpoch[j] = 0;
+        }
+        list->threads[i].retires = 0;
+    }
+}
+
+// Every thread using the list needs its own epoch record.
+// Returns NULL once MAX_THREADS threads have registered.
+struct EpochThread* registerThread(struct LockFreeList* list) {
+    int i = atomic_fetch_add(&list->threadCount, 1);
+
+    if (i >= MAX_THREADS) {
+        atomic_fetch_sub(&list->threadCount, 1);
+        return NULL;
+    }
+    return &list->threads[i];
+}
+
+/* ---------------------- EPOCH RECLAMATION ---------------------- */
+
+// Announces the current epoch. The announcement is checked against
+// the epoch again, so no epoch change can slip in between.
+void epochEnter(struct LockFreeList* list, struct EpochThread* self) {
+    long e;
+
+    do {
+        e = atomic_load(&list->globalEpoch);
+        atomic_store(&self->epoch, e);
+    } while (atomic_load(&list->globalEpoch) != e);
+}
+
+void epochExit(struct EpochThread* self) {
+    atomic_store_explicit(&self->epoch, EPOCH_IDLE, memory_order_release);
+}
+
+void freeBag(struct LockFreeList* list, struct EpochThread* self, int i) {
+    long count = 0;
+
+    while (self->bag[i] != NULL) {
+        struct Node* node = self->bag[i];
+        self->bag[i] = node->retiredNext;
+        free(node);
+        count++;
+    }
+    atomic_fetch_add_explicit(&list->freed, count, memory_order_relaxed);
+}
+
+// Moves the epoch on by one if every thread inside an operation has
+// announced the current one
+void tryAdvance(struct LockFreeList* list) {
+    long e = atomic_load(&list->globalEpoch);
+    int n = atomic_load(&list->threadCount), i;
+
+    if (n > MAX_THREADS)
+        n = MAX_THREADS;
+    for (i = 0; i < n; i++) {
+        long announced = atomic_load(&list->threads[i].epoch);
+        if (announced != EPOCH_IDLE && announced != e)
+            return;
+    }
+    atomic_compare_exchange_strong(&list->globalEpoch, &e, e + 1);
+}
+
+// Called by the thread that unlinked 'node', inside its operation
+void retireNode(struct LockFreeList* list, struct EpochThread* self, struct Node* node) {
+    long e = atomic_load(&list->globalEpoch);
+    int i = (int)(e % 3);
+
+    // A bag filled in an older epoch with the same e % 3 is at least
+    // three epochs old, so nobody can still be reading its nodes
+    if (self->bagEpoch[i] != e) {
+        freeBag(list, self, i);
+        self->bagEpoch[i] = e;
+    }
+    node->retiredNext = self->bag[i];
+    self->bag[i] = node;
+    atomic_fetch_add_explicit(&list->retired, 1, memory_order_relaxed);
+
+    if (++self->retires % RETIRE_SCAN == 0) {
+        tryAdvance(list);
+        e = atomic_load(&list->globalEpoch);
+        for (i = 0; i < 3; i++)
+            if (self->bag[i] != NULL && self->bagEpoch[i] <= e - 2)
+                freeBag(list, self, i);
+    }
+}
+
+/* ------------------------ LIST OPERATIONS ------------------------ */
+
+// Returns the first unmarked node with data >= key (or NULL) and
+// stores in *link the link that points to it. Marked nodes met on
+// the way are unlinked and retired. Must run inside an operation.
+struct Node* find(struct LockFreeList* list, struct EpochThread* self, int key, atomic_uintptr_t** link) {
+    atomic_uintptr_t* prev;
+    uintptr_t curr, next;
+
+retry:
+    prev = &list->head.next;
+    curr = atomic_load_explicit(prev, memory_order_acquire);
+
+    while (1) {
+        struct Node* node = ptrOf(curr);
+
+        if (node == NULL)
+            break;
+        next = atomic_load_explicit(&node->next, memory_order_acquire);
+
+        if (isMarked(next)) {
+            // Deleted: unlink it. The CAS fails if the predecessor
+            // changed or was marked itself; then start over.
+            if (!atomic_compare_exchange_strong_explicit(prev, &curr, next & ~MARK,
+                                                         memory_order_acq_rel, memory_order_acquire))
+                goto retry;
+            retireNode(list, self, node);
+            curr = next & ~MARK;
+            continue;
+        }
+
+        if (node->data >= key)
+            break;
+        prev = &node->next;
+        curr = next;
+    }
+
+    *link = prev;
+    return ptrOf(curr);
+}
+
+// Returns 1 if the value was added, 0 if it was already there
+int listInsert(struct LockFreeList* list, struct EpochThread* self, int value) {
+    struct Node* newNode = NULL;
+    atomic_uintptr_t* link;
+    int inserted;
+
+    epochEnter(list, self);
+    while (1) {
+        struct Node* curr = find(list, self, value, &link);
+        uintptr_t expected = (uintptr_t)curr;
+
+        if (curr != NULL && curr->data == value) {
+            inserted = 0;
+            break;
+        }
+        if (newNode == NULL)
+            newNode = createNode(value);
+        atomic_store_explicit(&newNode->next, (uintptr_t)curr, memory_order_relaxed);
+
+        // Publish: 'data' and 'next' are visible before the node is
+        if (atomic_compare_exchange_strong_explicit(link, &expected, (uintptr_t)newNode,
+                                                    memory_order_release, memory_order_relaxed)) {
+            inserted = 1;
+            break;
+        }
+    }
+    epochExit(self);
+
+    if (!inserted)
+        free(newNode);   // Never linked in, so no other thread saw it
+    return inserted;
+}
+
+// Returns 1 if this call deleted the value, 0 if it was not there
+int listDelete(struct LockFreeList* list, struct EpochThread* self, int value) {
+    atomic_uintptr_t* link;
+    int deleted;
+
+    epochEnter(list, self);
+    while (1) {
+        struct Node* curr = find(list, self, value, &link);
+        uintptr_t next, expected;
+
+        if (curr == NULL || curr->data != value) {
+            deleted = 0;
+            break;
+        }
+
+        // Logical delete: mark curr's own link
+        next = atomic_load_explicit(&curr->next, memory_order_acquire);
+        if (isMarked(next))
+            continue;   // Another thread deleted it first
+        if (!atomic_compare_exchange_strong_explicit(&curr->next, &next, next | MARK,
+                                                     memory_order_acq_rel, memory_order_relaxed))
+            continue;   // Its successor changed; look again
+
+        // Physical delete; if it fails, find unlinks it
+        expected = (uintptr_t)curr;
+        if (atomic_compare_exchange_strong_explicit(link, &expected, next,
+                                                    memory_order_acq_rel, memory_order_relaxed))
+            retireNode(list, self, curr);
+        else
+            find(list, self, value, &link);
+        deleted = 1;
+        break;
+    }
+    epochExit(self);
+    return deleted;
+}
+
+// Read-only search: marked nodes count as absent
+int listContains(struct LockFreeList* list, struct EpochThread* self, int value) {
+    struct Node* node;
+    int found;
+
+    epochEnter(list, self);
+    node = ptrOf(atomic_load_explicit(&list->head.next, memory_order_acquire));
+    while (node != NULL && node->data < value)
+        node = ptrOf(atomic_load_explicit(&node->next, memory_order_acquire));
+    found = node != NULL && node->data == value &&
+            !isMarked(atomic_load_explicit(&node->next, memory_order_acquire));
+    epochExit(self);
+    return found;
+}
+
+// No other thread may be using the list
+void destroyList(struct LockFreeList* list) {
+    struct Node* node = ptrOf(atomic_load(&list->head.next));
+    int i, j;
+
+    while (node != NULL) {
+        struct Node* next = ptrOf(atomic_load(&node->next));
+        free(node);
+        node = next;
+    }
+    for (i = 0; i < MAX_THREADS; i++)
+        for (j = 0; j < 3; j++)
+            freeBag(list, &list->threads[i], j);
+}
+
+// Single-threaded display and count (skip marked nodes)
+void displayList(struct LockFreeList* list) {
+    struct Node* node = ptrOf(atomic_load(&list->head.next));
+
+    if (node == NULL) {
+        printf("List is empty.\n");
+        return;
+    }
+
+    printf("Lock-Free List: ");
+    while (node != NULL) {
+        uintptr_t next = atomic_load(&node->next);
+        if (!isMarked(next))
+            printf("%d -> ", node->data);
+        node = ptrOf(next);
+    }
+    printf("NULL\n");
+}
+
+int countNodes(struct LockFreeList* list) {
+    struct Node* node = ptrOf(atomic_load(&list->head.next));
+    int count = 0;
+
+    while (node != NULL) {
+        uintptr_t next = atomic_load(&node->next);
+        count += !isMarked(next);
+        node = ptrOf(next);
+    }
+    return count;
+}
+
+double nowSeconds() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+/* ------------------- LINEARIZABILITY STRESS TEST -------------------
+   Many threads insert, delete and search random keys. Every call is
+   logged with its result and two ticks of a shared clock, taken just
+   before it starts and just after it returns.
+
+   The list is LINEARIZABLE if each call can be given one instant
+   between its two ticks, such that doing the calls one at a time in
+   that order gives exactly the logged results. Keys do not affect
+   each other, so every key's history is checked on its own (a set of
+   one key is just "present or not"), with the Wing & Gong search:
+   try each call that could come first (none of the other calls
+   returned before it started), apply it if its result fits, and
+   backtrack on dead ends. States already explored are remembered.
+   A key's history is cut where no call on it is running; each piece
+   is checked from every state the pieces before it can end in.
+---------------------------------------------------------------------*/
+
+enum { OP_INSERT, OP_DELETE, OP_CONTAINS };
+
+struct OpRecord {
+    int key;
+    int type;
+    int result;
+    long invoke, response;      // Clock ticks before and after the call
+};
+
+struct StressTest {
+    struct LockFreeList list;
+    int ops, keys;
+    atomic_long clock;
+};
+
+struct Worker {
+    pthread_t thread;
+    struct StressTest* test;
+    unsigned seed;
+    struct OpRecord* log;
+};
+
+void* workerMain(void* arg) {
+    struct Worker* w = (struct Worker*)arg;
+    struct StressTest* test = w->test;
+    struct EpochThread* self = registerThread(&test->list);
+    int i;
+
+    for (i = 0; i < test->ops; i++) {
+        struct OpRecord* r = &w->log[i];
+        int dice = rand_r(&w->seed) % 10;
+
+        r->key = rand_r(&w->seed) % test->keys;
+        r->type = dice < 4 ? OP_CONTAINS : dice < 7 ? OP_INSERT : OP_DELETE;
+        r->invoke = atomic_fetch_add(&test->clock, 1);
+        if (r->type == OP_INSERT)
+            r->result = listInsert(&test->list, self, r->key);
+        else if (r->type == OP_DELETE)
+            r->result = listDelete(&test->list, self, r->key);
+        else
+            r->result = listContains(&test->list, self, r->key);
+        r->response = atomic_fetch_add(&test->clock, 1);
+    }
+    return NULL;
+}
+
+int compareRecords(const void* a, const void* b) {
+    const struct OpRecord* x = (const struct OpRecord*)a;
+    const struct OpRecord* y = (const struct OpRecord*)b;
+
+    if (x->key != y->key)
+        return (x->key > y->key) - (x->key < y->key);
+    return (x->invoke > y->invoke) - (x->invoke < y->invoke);
+}
+
+// Explored states: (calls already placed, present or not).
+// 'round' tags the entries of the piece being checked.
+struct Memo {
+    uint64_t state[MEMO_SIZE];
+    int round[MEMO_SIZE];
+    int current;
+};
+
+// Returns 1 if the state was already in the table, else adds it
+int memoSeen(struct Memo* memo, uint64_t state) {
+    unsigned i = (unsigned)((state * 0x9E3779B97F4A7C15ULL) >> 50) & (MEMO_SIZE - 1);
+    int probes;
+
+    for (probes = 0; probes < MEMO_SIZE; probes++, i = (i + 1) & (MEMO_SIZE - 1)) {
+        if (memo->round[i] != memo->current) {
+            memo->round[i] = memo->current;
+            memo->state[i] = state;
+            return 0;
+        }
+        if (memo->state[i] == state)
+            return 1;
+    }
+    return 0;   // Table full: just search again
+}
+
+// Puts in *ends (bit 0: absent, bit 1: present) every state the key
+// can be in after the calls of ops[0, n) that are not in 'done', in
+// any valid order, starting from 'present'
+void linearize(const struct OpRecord* ops, int n, uint64_t done, int present, struct Memo* memo, int* ends) {
+    long firstReturn = -1;
+    int i;
+
+    if (done == (1ULL << n) - 1) {
+        *ends |= 1 << present;
+        return;
+    }
+    if (memoSeen(memo, done << 1 | (uint64_t)present))
+        return;
+
+    // A call may go next only if it started before every other
+    // remaining call returned
+    for (i = 0; i < n; i++)
+        if (!(done >> i & 1) && (firstReturn < 0 || ops[i].response < firstReturn))
+            firstReturn = ops[i].response;
+
+    for (i = 0; i < n; i++) {
+        const struct OpRecord* r = &ops[i];
+        int after;
+
+        if ((done >> i & 1) || r->invoke > firstReturn)
+            continue;
+
+        // Does the logged result fit, and what is the set after it?
+        if (r->type == OP_INSERT) {
+            if (r->result != !present)
+                continue;
+            after = 1;
+        } else if (r->type == OP_DELETE) {
+            if (r->result != present)
+                continue;
+            after = 0;
+        } else {
+            if (r->result != present)
+                continue;
+            after = present;
+        }
+
+        linearize(ops, n, done | 1ULL << i, after, memo, ends);
+    }
+}
+
+// Checks the history ops[0, n) of one key (sorted by start). Returns
+// 1 if linearizable, 0 if not, -1 if a piece is too long to check.
+int checkKey(const struct OpRecord* ops, long n, struct Memo* memo) {
+    int states = 1;     // The key starts absent
+    long start = 0;
+
+    while (start < n) {
+        long end = start + 1, lastReturn = ops[start].response;
+        int ends = 0, present;
+
+        // The piece ends where every call so far has returned
+        while (end < n && ops[end].invoke < lastReturn) {
+            if (ops[end].response > lastReturn)
+                lastReturn = ops[end].response;
+            end++;
+        }
+        if (end - start > MAX_KEY_OPS)
+            return -1;
+
+        memo->current++;
+        for (present = 0; present <= 1; present++)
+            if (states >> present & 1)
+                linearize(ops + start, (int)(end - start), 0, present, memo, &ends);
+        if (ends == 0)
+            return 0;
+        states = ends;
+        start = end;
+    }
+    return 1;
+}
+
+void stressTest(int threads, int ops, int keys) {
+    struct StressTest* test;
+    struct Worker worker[MAX_THREADS];
+    struct OpRecord* all;
+    struct Memo* memo;
+    long total, start, checked = 0, skipped = 0, failedKey = -1;
+    int i;
+
+    if (threads < 1 || ops < 1 || keys < 0) {
+        printf("Need at least one thread and one operation (and 0 or more keys).\n");
+        return;
+    }
+    if (threads > MAX_THREADS)
+        threads = MAX_THREADS;
+    // Few keys make the calls on each key pile up past MAX_KEY_OPS,
+    // so the default spreads them out
+    if (keys == 0)
+        keys = (int)((long)threads * ops / CALLS_PER_KEY) + 1;
+
+    test = (struct StressTest*)malloc(sizeof(struct StressTest));
+    createList(&test->list);
+    test->ops = ops;
+    test->keys = keys;
+    atomic_init(&test->clock, 0);
+    total = (long)threads * ops;
+    all = (struct OpRecord*)malloc(total * sizeof(struct OpRecord));
+
+    double begin = nowSeconds();
+    for (i = 0; i < threads; i++) {
+        worker[i].test = test;
+        worker[i].seed = (unsigned)time(NULL) * 2654435761u + (unsigned)i;
+        worker[i].log = all + (long)i * ops;
+        pthread_create(&worker[i].thread, NULL, workerMain, &worker[i]);
+    }
+    for (i = 0; i < threads; i++)
+        pthread_join(worker[i].thread, NULL);
+    double elapsed = nowSeconds() - begin;
+
+    printf("%d threads x %d operations on %d keys: %.2f ms\n", threads, ops, keys, elapsed * 1e3);
+    printf("Nodes retired: %ld, freed while running: %ld\n",
+           atomic_load(&test->list.retired), atomic_load(&test->list.freed));
+
+    // Check every key's history on its own
+    qsort(all, total, sizeof(struct OpRecord), compareRecords);
+    memo = (struct Memo*)calloc(1, sizeof(struct Memo));
+    for (start = 0; start < total && failedKey < 0; ) {
+        long end = start;
+
+        while (end < total && all[end].key == all[start].key)
+            end++;
+        switch (checkKey(all + start, end - start, memo)) {
+            case 1:
+                checked++;
+                break;
+            case 0:
+                failedKey = all[start].key;
+                break;
+            default:
+                skipped++;
+        }
+        start = end;
+    }
+
+    // Skipped keys are the busiest ones, where bugs are most likely,
+    // so PASSED is only printed if nearly every key was checked
+    if (failedKey >= 0)
+        printf("FAILED: the history of key %ld is not linearizable.\n", failedKey);
+    else if (checked == 0 || skipped * 100 > (checked + skipped) * MAX_SKIPPED_PERCENT)
+        printf("INCONCLUSIVE: only %ld of %ld key histories were checked (all linearizable); "
+               "%ld had more than %d overlapping calls. Use more keys or fewer threads.\n",
+               checked, checked + skipped, skipped, MAX_KEY_OPS);
+    else if (skipped > 0)
+        printf("PASSED: %ld key histories are linearizable (%ld with more than %d overlapping calls not checked).\n",
+               checked, skipped, MAX_KEY_OPS);
+    else
+        printf("PASSED: %ld key histories are linearizable.\n", checked);
+
+    destroyList(&test->list);
+    free(test);
+    free(all);
+    free(memo);
+}
+
+/* --------------------------- BENCHMARK ---------------------------
+   The same mix of calls on this list and on the sorted list of
+   01_sll.c behind one mutex. Both start half full.
+------------------------------------------------------------------*/
+
+// Node of the mutex list: a plain 01_sll.c node
+struct PlainNode {
+    int data;
+    struct PlainNode* next;
+};
+
+struct MutexList {
+    pthread_mutex_t lock;
+    struct PlainNode* head;
+};
+
+int mutexInsert(struct MutexList* m, int value) {
+    struct PlainNode** link;
+    int inserted = 0;
+
+    pthread_mutex_lock(&m->lock);
+    for (link = &m->head; *link != NULL && (*link)->data < value; link = &(*link)->next)
+        ;
+    if (*link == NULL || (*link)->data != value) {
+        struct PlainNode* newNode = (struct PlainNode*)malloc(sizeof(struct PlainNode));
+        newNode->data = value;
+        newNode->next = *link;
+        *link = newNode;
+        inserted = 1;
+    }
+    pthread_mutex_unlock(&m->lock);
+    return inserted;
+}
+
+int mutexDelete(struct MutexList* m, int value) {
+    struct PlainNode** link;
+    struct PlainNode* node = NULL;
+
+    pthread_mutex_lock(&m->lock);
+    for (link = &m->head; *link != NULL && (*link)->data < value; link = &(*link)->next)
+        ;
+    if (*link != NULL && (*link)->data == value) {
+        node = *link;
+        *link = node->next;
+    }
+    pthread_mutex_unlock(&m->lock);
+    free(node);
+    return node != NULL;
+}
+
+int mutexContains(struct MutexList* m, int value) {
+    struct PlainNode* node;
+    int found;
+
+    pthread_mutex_lock(&m->lock);
+    for (node = m->head; node != NULL && node->data < value; node = node->next)
+        ;
+    found = node != NULL && node->data == value;
+    pthread_mutex_unlock(&m->lock);
+    return found;
+}
+
+struct BenchJob {
+    pthread_t thread;
+    struct LockFreeList* list;  // NULL: use 'locked'
+    struct MutexList* locked;
+    int ops, keys, readPercent;
+    unsigned seed;
+};
+
+void* benchMain(void* arg) {
+    struct BenchJob* job = (struct BenchJob*)arg;
+    struct EpochThread* self = job->list != NULL ? registerThread(job->list) : NULL;
+    int i;
+
+    for (i = 0; i < job->ops; i++) {
+        int key = rand_r(&job->seed) % job->keys;
+        int dice = rand_r(&job->seed) % 100;
+
+        if (job->list != NULL) {
+            if (dice < job->readPercent)
+                listContains(job->list, self, key);
+            else if (dice % 2 == 0)
+                listInsert(job->list, self, key);
+            else
+                listDelete(job->list, self, key);
+        } else {
+            if (dice < job->readPercent)
+                mutexContains(job->locked, key);
+            else if (dice % 2 == 0)
+                mutexInsert(job->locked, key);
+            else
+                mutexDelete(job->locked, key);
+        }
+    }
+    return NULL;
+}
+
+void runBenchmark(int threads, int ops, int keys, int readPercent) {
+    struct LockFreeList* list = (struct LockFreeList*)malloc(sizeof(struct LockFreeList));
+    struct MutexList locked;
+    struct BenchJob job[MAX_THREADS];
+    struct EpochThread* self;
+    double times[2];
+    int i, round;
+
+    if (threads < 1 || ops < 1 || keys < 1) {
+        printf("Need at least one thread, one operation and one key.\n");
+        free(list);
+        return;
+    }
+    if (threads > MAX_THREADS - 1)
+        threads = MAX_THREADS - 1;
+
+    createList(list);
+    self = registerThread(list);
+    pthread_mutex_init(&locked.lock, NULL);
+    locked.head = NULL;
+    for (i = 0; i < keys; i += 2) {
+        listInsert(list, self, i);
+        mutexInsert(&locked, i);
+    }
+
+    for (round = 0; round < 2; round++) {
+        double start = nowSeconds();
+        for (i = 0; i < threads; i++) {
+            job[i].list = round == 0 ? list : NULL;
+            job[i].locked = &locked;
+            job[i].ops = ops;
+            job[i].keys = keys;
+            job[i].readPercent = readPercent;
+            job[i].seed = 12345u + (unsigned)i;
+            pthread_create(&job[i].thread, NULL, benchMain, &job[i]);
+        }
+        for (i = 0; i < threads; i++)
+            pthread_join(job[i].thread, NULL);
+        times[round] = nowSeconds() - start;
+    }
+
+    printf("%d threads x %d calls, %d keys, %d%% searches:\n", threads, ops, keys, readPercent);
+    printf("Lock-free list:  %9.2f ms  %8.2f M calls/s\n", times[0] * 1e3,
+           (double)threads * ops / times[0] / 1e6);
+    printf("Mutex list:      %9.2f ms  %8.2f M calls/s\n", times[1] * 1e3,
+           (double)threads * ops / times[1] / 1e6);
+
+    destroyList(list);
+    free(list);
+    while (locked.head != NULL) {
+        struct PlainNode* next = locked.head->next;
+        free(locked.head);
+        locked.head = next;
+    }
+    pthread_mutex_destroy(&locked.lock);
+}
+
+// MAIN FUNCTION — Menu-driven program (single thread, except tests)
+int main() {
+    struct LockFreeList* list = (struct LockFreeList*)malloc(sizeof(struct LockFreeList));
+    struct EpochThread* self;
+    int choice, value, threads, ops, keys, reads;
+
+    createList(list);
+    self = registerThread(list);
+
+    while (1) {
+        printf("\n--- LOCK-FREE SORTED LIST OPERATIONS ---\n");
+        printf("1. Insert Value\n");
+        printf("2. Delete by Value\n");
+        printf("3. Search Value\n");
+        printf("4. Display List\n");
+        printf("5. Count Nodes\n");
+        printf("6. Linearizability Stress Test\n");
+        printf("7. Benchmark against Mutex List\n");
+        printf("8. Exit\n");
+        printf("Enter your choice: ");
+        if (scanf("%d", &choice) != 1)
+            break;
+
+        switch (choice) {
+            case 1:
+                printf("Enter value to insert: ");
+                scanf("%d", &value);
+                if (listInsert(list, self, value))
+                    printf("Value %d inserted.\n", value);
+                else
+                    printf("Duplicate value! Ignored.\n");
+                break;
+
+            case 2:
+                printf("Enter value to delete: ");
+                scanf("%d", &value);
+                if (listDelete(list, self, value))
+                    printf("Node with value %d deleted.\n", value);
+                else
+                    printf("Value not found.\n");
+                break;
+
+            case 3:
+                printf("Enter value to search: ");
+                scanf("%d", &value);
+                if (listContains(list, self, value))
+                    printf("Value %d found in list.\n", value);
+                else
+                    printf("Value %d not found.\n", value);
+                break;
+
+            case 4:
+                displayList(list);
+                break;
+
+            case 5:
+                printf("Total nodes: %d\n", countNodes(list));
+                break;
+
+            case 6:
+                printf("Enter number of threads, operations per thread and keys (0 keys for default): ");
+                scanf("%d %d %d", &threads, &ops, &keys);
+                stressTest(threads, ops, keys);
+                break;
+
+            case 7:
+                printf("Enter number of threads, calls per thread, keys and search percentage: ");
+                scanf("%d %d %d %d", &threads, &ops, &keys, &reads);
+                runBenchmark(threads, ops, keys, reads);
+                break;
+
+            case 8:
+                printf("Exiting program...\n");
+                destroyList(list);
+                free(list);
+                exit(0);
+
+            default:
+                printf("Invalid choice! Try again.\n");
+        }
+    }
+
+    destroyList(list);
+    free(list);
+    return 0;
+}
@@ -0,0 +1,213 @@
+#ifndef BLOOM_H
+#define BLOOM_H
+
+/* ------------------------ BLOOM FILTER ------------------------
+   Most searches for a value that is not there still walk the whole
+   tree height or the whole list. Compile with -DBLOOM_FILTER to put
+   a Bloom filter in front of them:
+       gcc -DBLOOM_FILTER 06_binarySearchTree.c -o bst -lm
+   Every value added to the structure is added to the filter. If the
+   filter says "not seen", the value is certainly missing and the
+   structure is not touched; otherwise the normal search runs (the
+   filter can be wrong in that direction: a FALSE POSITIVE).
+
+   BLOCKED layout: the filter is an array of 64-byte blocks (one
+   cache line, 512 bits). A value's hash picks one block, and all of
+   its k bits are set in that block, so a check reads one cache line.
+
+   Bits cannot be cleared (they are shared by several values), so a
+   delete only counts the value as REMOVED. The program rebuilds the
+   filter from its structure when BLOOM_NEEDS_REBUILD() says too many
+   values were removed, or more were added than it was sized for.
+
+   The target false-positive rate is BLOOM_RATE (default 1%), or the
+   BLOOM_RATE environment variable if set. BLOOM_REPORT() prints the
+   memory used and the estimated and observed rates.
+   Without -DBLOOM_FILTER every macro expands to nothing (and
+   BLOOM_MAY_CONTAIN to 1), so the programs behave as before.
+-----------------------------------------------------------------*/
+
+#ifdef BLOOM_FILTER
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <math.h>
+
+#ifndef BLOOM_RATE
+#define BLOOM_RATE 0.01
+#endif
+
+#define BLOOM_BLOCK_BITS 512
+#define BLOOM_BLOCK_WORDS (BLOOM_BLOCK_BITS / 64)
+#define BLOOM_MIN_KEYS 1024       // Smallest number of values sized for
+
+struct BloomFilter {
+    uint64_t* blocks;         // blockCount * BLOOM_BLOCK_WORDS words, 64-byte aligned
+    size_t blockCount;
+    int hashes;               // Bits set per value (k)
+    double rate;              // Target false-positive rate
+    size_t expected;          // Values the filter was sized for
+    size_t added;             // Values added since the last rebuild
+    size_t removed;           // Of those, values deleted again
+    long lookups, rejected, falsePositives, rebuilds;
+};
+
+static inline uint64_t bloomHash(int value) {
+    // MurmurHash3 finalizer: every input bit affects every output bit
+    uint64_t h = (uint64_t)(uint32_t)value;
+    h ^= h >> 33;
+    h *= 0xFF51AFD7ED558CCDULL;
+    h ^= h >> 33;
+    h *= 0xC4CEB9FE1A85EC53ULL;
+    h ^= h >> 33;
+    return h;
+}
+
+// Builds the k-bit pattern of a hash inside its block and returns
+// the block. Bit i is at a + i*b (mod 512); b is odd, so the k
+// positions are all different.
+static inline uint64_t* bloomPattern(const struct BloomFilter* f, uint64_t h, uint64_t pattern[]) {
+    unsigned a = (unsigned)h & (BLOOM_BLOCK_BITS - 1);
+    unsigned b = ((unsigned)(h >> 9) & (BLOOM_BLOCK_BITS - 1)) | 1;
+    int i;
+
+    memset(pattern, 0, BLOOM_BLOCK_WORDS * sizeof(uint64_t));
+    for (i = 0; i < f->hashes; i++) {
+        unsigned bit = (a + (unsigned)i * b) & (BLOOM_BLOCK_BITS - 1);
+        pattern[bit / 64] |= 1ULL << (bit % 64);
+    }
+    // Top 32 bits pick the block (multiply-shift instead of modulo)
+    return f->blocks + ((h >> 32) * f->blockCount >> 32) * BLOOM_BLOCK_WORDS;
+}
+
+// Empties the filter and sizes it for 'expected' values
+static inline void bloomReset(struct BloomFilter* f, size_t expected) {
+    const char* env = getenv("BLOOM_RATE");
+    const double ln2 = 0.69314718055994531;
+    double bitsPerValue;
+
+    if (f->rate <= 0)
+        f->rate = env != NULL && atof(env) > 0 && atof(env) < 1 ? atof(env) : BLOOM_RATE;
+    if (expected < BLOOM_MIN_KEYS)
+        expected = BLOOM_MIN_KEYS;
+
+    // Classic sizing: -ln(p) / ln(2)^2 bits and ln(2) * bits hashes per value
+    bitsPerValue = -log(f->rate) / (ln2 * ln2);
+    f->hashes = (int)(bitsPerValue * ln2 + 0.5);
+    if (f->hashes < 1)
+        f->hashes = 1;
+    if (f->hashes > 16)
+        f->hashes = 16;
+
+    free(f->blocks);
+    f->blockCount = (size_t)(expected * bitsPerValue / BLOOM_BLOCK_BITS) + 1;
+    f->blocks = (uint64_t*)aligned_alloc(64, f->blockCount * BLOOM_BLOCK_BITS / 8);
+    memset(f->blocks, 0, f->blockCount * BLOOM_BLOCK_BITS / 8);
+    f->expected = expected;
+    f->added = 0;
+    f->removed = 0;
+}
+
+static inline void bloomAdd(struct BloomFilter* f, int value) {
+    uint64_t pattern[BLOOM_BLOCK_WORDS];
+    uint64_t* block;
+    int i;
+
+    if (f->blocks == NULL)
+        bloomReset(f, BLOOM_MIN_KEYS);
+    block = bloomPattern(f, bloomHash(value), pattern);
+    for (i = 0; i < BLOOM_BLOCK_WORDS; i++)
+        block[i] |= pattern[i];
+    f->added++;
+}
+
+// 0: value was never added. 1: value may have been added.
+static inline int bloomMayContain(struct BloomFilter* f, int value) {
+    uint64_t pattern[BLOOM_BLOCK_WORDS];
+    const uint64_t* block;
+    uint64_t missing = 0;
+    int i;
+
+    f->lookups++;
+    if (f->blocks == NULL) {
+        f->rejected++;
+        return 0;
+    }
+    block = bloomPattern(f, bloomHash(value), pattern);
+    for (i = 0; i < BLOOM_BLOCK_WORDS; i++)
+        missing |= pattern[i] & ~block[i];
+    if (missing != 0)
+        f->rejected++;
+    return missing == 0;
+}
+
+// True once half of the added values were deleted again (their bits
+// only cause false positives now), or the filter is over capacity
+static inline int bloomNeedsRebuild(const struct BloomFilter* f) {
+    return f->added > f->expected ||
+           (f->removed > BLOOM_MIN_KEYS / 16 && 2 * f->removed > f->added);
+}
+
+// Starts a rebuild: the caller adds every value it holds again
+static inline void bloomRebuild(struct BloomFilter* f) {
+    bloomReset(f, 2 * (f->added - f->removed));
+    f->rebuilds++;
+}
+
+// Expected false-positive rate for values never added: a check
+// passes if all k bits of its block are set, so it is the average
+// over all blocks of (fraction of bits set)^k
+static inline double bloomEstimatedRate(const struct BloomFilter* f) {
+    double sum = 0;
+    size_t b;
+    int i;
+
+    for (b = 0; b < f->blockCount; b++) {
+        int set = 0;
+        for (i = 0; i < BLOOM_BLOCK_WORDS; i++)
+            set += __builtin_popcountll(f->blocks[b * BLOOM_BLOCK_WORDS + i]);
+        sum += pow((double)set / BLOOM_BLOCK_BITS, f->hashes);
+    }
+    return f->blockCount > 0 ? sum / f->blockCount : 0;
+}
+
+static inline void bloomReport(const struct BloomFilter* f, FILE* out) {
+    long passed = f->lookups - f->rejected;
+
+    fprintf(out, "Bloom filter: %zu bytes (%zu blocks of 64), %d hashes, sized for %zu values\n",
+            f->blockCount * BLOOM_BLOCK_BITS / 8, f->blockCount, f->hashes, f->expected);
+    fprintf(out, "Values added: %zu, deleted: %zu, rebuilds: %ld\n",
+            f->added, f->removed, f->rebuilds);
+    fprintf(out, "False-positive rate: target %.3f%%, estimated now %.3f%%\n",
+            100 * f->rate, 100 * (f->blocks != NULL ? bloomEstimatedRate(f) : 0));
+    // Passed but missing: true false positives plus deleted values
+    // whose bits are still set
+    fprintf(out, "Lookups: %ld, rejected by filter: %ld, passed: %ld, passed but missing: %ld\n",
+            f->lookups, f->rejected, passed, f->falsePositives);
+}
+
+#define BLOOM_DEFINE()           struct BloomFilter bloom = { NULL, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 }
+#define BLOOM_ADD(value)         bloomAdd(&bloom, (value))
+#define BLOOM_MAY_CONTAIN(value) bloomMayContain(&bloom, (value))
+#define BLOOM_REMOVED()          (bloom.removed++)
+#define BLOOM_FALSE_POSITIVE()   (bloom.falsePositives++)
+#define BLOOM_NEEDS_REBUILD()    bloomNeedsRebuild(&bloom)
+#define BLOOM_REBUILD()          bloomRebuild(&bloom)
+#define BLOOM_REPORT()           bloomReport(&bloom, stdout)
+
+#else
+
+#define BLOOM_DEFINE()           struct BloomFilter
+#define BLOOM_ADD(value)         ((void)0)
+#define BLOOM_MAY_CONTAIN(value) 1
+#define BLOOM_REMOVED()          ((void)0)
+#define BLOOM_FALSE_POSITIVE()   ((void)0)
+#define BLOOM_NEEDS_REBUILD()    0
+#define BLOOM_REBUILD()          ((void)0)
+#define BLOOM_REPORT()           ((void)0)
+
+#endif
+
+#endif
@@ -0,0 +1,189 @@
+#ifndef BULKLOAD_H
+#define BULKLOAD_H
+
+/* ------------------------ BULK INTEGER LOADER ------------------------
+   Reads a whole file of integers without scanf, for programs that
+   need to fill a structure with millions of values:
+
+       long long n = loadIntegers("values.txt", FORMAT_TEXT, sink, ctx);
+
+   The file is memory-mapped (no read() copies). Values are handed
+   to 'sink' in batches of up to LOAD_BATCH, so a structure's bulk
+   insert can take them straight from the loader.
+
+   FORMAT_TEXT:   decimal integers separated by any non-digit bytes
+                  (spaces, newlines, commas), with an optional '-'.
+                  Digits are converted eight at a time with integer
+                  arithmetic on a 64-bit word (SWAR: SIMD within a
+                  register) instead of one multiply per digit.
+   FORMAT_BINARY: raw 32-bit ints in this machine's byte order.
+                  Batches point straight into the mapped file.
+   Text values outside the int range are clamped to INT_MIN / INT_MAX.
+--------------------------------------------------------------------*/
+
+// mmap and madvise are not ISO C. The define only takes effect if
+// no system header was included before this one, so programs that
+// include <stdio.h> first define it themselves.
+#ifndef _DEFAULT_SOURCE
+#define _DEFAULT_SOURCE
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <limits.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#define LOAD_BATCH 4096
+
+enum { FORMAT_TEXT, FORMAT_BINARY };
+
+// Receives the next 'count' values of the file
+typedef void (*IntSink)(const int* values, size_t count, void* ctx);
+
+#define HIGHS 0x8080808080808080ULL
+#define DIGITS_LIMIT 10000000000LL   // Past any int; keeps value * 10^8 inside int64_t
+
+// Number of leading digit characters in the 8 bytes of 'word'
+// (first character in the lowest byte)
+static inline int digitRun(uint64_t word) {
+    // A byte is a digit if its high nibble is 3 and adding 6 does not
+    // carry out of its low nibble, i.e. the low nibble is 0 to 9
+    uint64_t bad = ((word & 0xF0F0F0F0F0F0F0F0ULL) ^ 0x3030303030303030ULL) |
+                   (((word + 0x0606060606060606ULL) & 0xF0F0F0F0F0F0F0F0ULL) ^ 0x3030303030303030ULL);
+    // High bit of each byte that is not a digit (no carries between bytes)
+    uint64_t mark = (((bad & ~HIGHS) + ~HIGHS) | bad) & HIGHS;
+    return mark == 0 ? 8 : __builtin_ctzll(mark) / 8;
+}
+
+// Value of the first 'len' (1 to 8) digit characters of 'word'
+static inline uint32_t digitsValue(uint64_t word, int len) {
+    uint64_t d = word - 0x3030303030303030ULL;
+
+    // Move the digits to the top bytes; the bytes shifted in are
+    // zero, so they act as leading zeros of an 8-digit number
+    d <<= 8 * (8 - len);
+
+    // Combine neighbours: 8 digits -> 4 two-digit -> 2 four-digit -> 1
+    d = (d * 10) + (d >> 8);
+    d = (((d & 0x000000FF000000FFULL) * (100 + (1000000ULL << 32))) +
+         (((d >> 16) & 0x000000FF000000FFULL) * (1 + (10000ULL << 32)))) >> 32;
+    return (uint32_t)d;
+}
+
+// Parses every integer in text[0, length) and passes them to 'sink'.
+// Returns how many were found.
+static inline long long parseIntegers(const char* text, size_t length, IntSink sink, void* ctx) {
+    const char* p = text;
+    const char* end = text + length;
+    const char* fastEnd = length >= 8 ? end - 8 : text;   // 8 bytes readable below this
+    static const int64_t scale[9] = { 1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000 };
+    int batch[LOAD_BATCH];
+    size_t n = 0;
+    long long total = 0;
+
+    while (p < end) {
+        int negative = 0;
+        int64_t value = 0;
+
+        // Skip separators; a '-' right before a digit is a sign
+        if ((unsigned)(*p - '0') > 9) {
+            if (*p == '-' && p + 1 < end && (unsigned)(p[1] - '0') <= 9)
+                negative = 1;
+            p++;
+            if (!negative)
+                continue;
+        }
+
+        // Digits: up to eight at a time while 8 bytes can be read
+        // safely, then one at a time near the end of the file
+        while (p < fastEnd) {
+            uint64_t word;
+            int len;
+
+            memcpy(&word, p, 8);
+            len = digitRun(word);
+            if (len == 0)
+                break;
+            value = value * scale[len] + digitsValue(word, len);
+            if (value > DIGITS_LIMIT)
+                value = DIGITS_LIMIT;   // A long digit run must not overflow
+            p += len;
+            if (len < 8)
+                break;   // The number ended inside this word
+        }
+        while (p < end && (unsigned)(*p - '0') <= 9) {
+            value = value * 10 + (*p++ - '0');
+            if (value > DIGITS_LIMIT)
+                value = DIGITS_LIMIT;
+        }
+
+        if (value > (int64_t)INT_MAX + negative)
+            value = (int64_t)INT_MAX + negative;
+        batch[n++] = (int)(negative ? -value : value);
+        if (n == LOAD_BATCH) {
+            sink(batch, n, ctx);
+            total += n;
+            n = 0;
+        }
+    }
+
+    if (n > 0) {
+        sink(batch, n, ctx);
+        total += n;
+    }
+    return total;
+}
+
+// Loads every integer of a file into 'sink'. Returns how many were
+// loaded, or -1 if the file cannot be read.
+static inline long long loadIntegers(const char* path, int format, IntSink sink, void* ctx) {
+    struct stat info;
+    long long total = 0;
+    int fd = open(path, O_RDONLY);
+
+    if (fd < 0) {
+        printf("Cannot open file '%s'.\n", path);
+        return -1;
+    }
+    if (fstat(fd, &info) < 0) {
+        printf("Cannot read file '%s'.\n", path);
+        close(fd);
+        return -1;
+    }
+    if (info.st_size == 0) {
+        close(fd);
+        return 0;
+    }
+
+    const char* data = (const char*)mmap(NULL, info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);   // The mapping stays valid without the descriptor
+    if (data == MAP_FAILED) {
+        printf("Cannot map file '%s'.\n", path);
+        return -1;
+    }
+    madvise((void*)data, info.st_size, MADV_SEQUENTIAL);
+
+    if (format == FORMAT_BINARY) {
+        const int* values = (const int*)data;
+        size_t count = info.st_size / sizeof(int), i;
+
+        for (i = 0; i < count; i += LOAD_BATCH)
+            sink(values + i, count - i < LOAD_BATCH ? count - i : LOAD_BATCH, ctx);
+        total = (long long)count;
+    } else {
+        total = parseIntegers(data, info.st_size, sink, ctx);
+    }
+
+    munmap((void*)data, info.st_size);
+    return total;
+}
+
+#undef HIGHS
+#undef DIGITS_LIMIT
+
+#endif
@@ -0,0 +1,117 @@
+#ifndef FASTOUT_H
+#define FASTOUT_H
+
+/* ------------------------ FAST OUTPUT ------------------------
+   Display and traversal functions print one value at a time. With
+   printf that means a stdio lock and a format string parse per
+   value. Compile with -DFAST_OUTPUT to send those values through
+   this file instead:
+       gcc -DFAST_OUTPUT 06_binarySearchTree.c -o bst
+   - Integers are converted with a table of the 100 two-digit pairs
+     (two digits per division instead of one).
+   - Text goes into one large buffer that is written with a single
+     write() call when it fills up or when OUT_FLUSH() is called.
+   - Before the first value, stdout is flushed, so text printed
+     with printf before a traversal still comes out first. Call
+     OUT_FLUSH() before going back to printf.
+   Without -DFAST_OUTPUT the macros are plain printf calls, so the
+   output is the same byte for byte.
+   The traversals and displays of 01-06, 08-10, 12 and 15 use it.
+---------------------------------------------------------------*/
+
+#include <stdio.h>
+
+#ifdef FAST_OUTPUT
+
+#include <string.h>
+#include <unistd.h>
+
+#define OUT_BUFFER_SIZE (1 << 16)
+
+static char outBuffer[OUT_BUFFER_SIZE];
+static size_t outUsed = 0;
+
+static const char digitPairs[201] =
+    "00010203040506070809101112131415161718192021222324252627282930313233343536373839"
+    "40414243444546474849505152535455565758596061626364656667686970717273747576777879"
+    "8081828384858687888990919293949596979899";
+
+// Writes the whole buffer to standard output
+static inline void outFlush(void) {
+    size_t done = 0;
+
+    while (done < outUsed) {
+        ssize_t n = write(STDOUT_FILENO, outBuffer + done, outUsed - done);
+        if (n <= 0)
+            break;
+        done += (size_t)n;
+    }
+    outUsed = 0;
+}
+
+// Makes room for 'len' more bytes. Before the first byte of a new
+// batch, whatever printf still holds is sent out first.
+static inline void outReserve(size_t len) {
+    if (outUsed == 0)
+        fflush(stdout);
+    else if (outUsed + len > OUT_BUFFER_SIZE)
+        outFlush();
+}
+
+static inline void outText(const char* s) {
+    size_t len = strlen(s);
+
+    if (len > OUT_BUFFER_SIZE) {
+        outFlush();
+        fflush(stdout);
+        fputs(s, stdout);
+        fflush(stdout);
+        return;
+    }
+    outReserve(len);
+    memcpy(outBuffer + outUsed, s, len);
+    outUsed += len;
+}
+
+static inline void outInt(int value) {
+    char digits[12];
+    char* p = digits + sizeof(digits);
+    unsigned u = value < 0 ? 0u - (unsigned)value : (unsigned)value;
+    size_t len;
+
+    // Two digits per step, from the right
+    while (u >= 100) {
+        unsigned pair = (u % 100) * 2;
+        u /= 100;
+        *--p = digitPairs[pair + 1];
+        *--p = digitPairs[pair];
+    }
+    if (u >= 10) {
+        *--p = digitPairs[u * 2 + 1];
+        *--p = digitPairs[u * 2];
+    } else {
+        *--p = (char)('0' + u);
+    }
+    if (value < 0)
+        *--p = '-';
+
+    len = (size_t)(digits + sizeof(digits) - p);
+    outReserve(len);
+    memcpy(outBuffer + outUsed, p, len);
+    outUsed += len;
+}
+
+// 'tail' must be a string literal, e.g. OUT_INT(x, " ")
+#define OUT_INT(value, tail)  (outInt(value), outText(tail))
+#define OUT_TEXT(text)        outText(text)
+#define OUT_FLUSH()           outFlush()
+
+#else
+
+#define OUT_INT(value, tail)  printf("%d" tail, (value))
+#define OUT_TEXT(text)        fputs((text), stdout)
+#define OUT_FLUSH()           ((void)0)
+
+#endif
+
+#endif
@@ -0,0 +1,93 @@
+#ifndef INSTRUMENT_H
+#define INSTRUMENT_H
+
+/* ----------------------- HOT-PATH COUNTERS -----------------------
+   Compile a program with -DINSTRUMENT to count what its operations
+   actually do, for example:
+       gcc -DINSTRUMENT 05_binaryTree.c -o binaryTree
+   Each program declares one set of counters for its structure with
+   STATS_DEFINE("name") and calls STATS_DUMP() on exit. The dump is
+   printed as key=value lines, or as JSON if the STATS_JSON
+   environment variable is set.
+   Without -DINSTRUMENT every macro expands to nothing (or to its
+   plain expression), so the counters cost nothing.
+   Programs 01-06, 08-10, 12, 14 and 15 are instrumented. The
+   counters are plain globals, so the threaded programs do not use
+   them.
+-------------------------------------------------------------------*/
+
+#ifdef INSTRUMENT
+
+#include <stdio.h>
+#include <stdlib.h>
+
+struct Stats {
+    const char* name;       // Which structure these counters belong to
+    long nodesTraversed;    // Nodes / slots stepped over by any walk
+    long comparisons;       // Value comparisons
+    long allocations;       // Successful malloc calls
+    long frees;             // free calls
+    long bytesLive;         // Bytes currently allocated
+    long bytesPeak;         // Highest value of bytesLive
+    long height;            // Tree height (trees only)
+    long queueFull;         // Insert refused because the queue was full
+    long queueEmpty;        // Delete refused because the queue was empty
+};
+
+static inline void statAlloc(struct Stats* s, long bytes) {
+    s->allocations++;
+    s->bytesLive += bytes;
+    if (s->bytesLive > s->bytesPeak)
+        s->bytesPeak = s->bytesLive;
+}
+
+static inline void statFree(struct Stats* s, long bytes) {
+    s->frees++;
+    s->bytesLive -= bytes;
+}
+
+// Prints every counter as key=value lines or as one JSON object
+static inline void dumpStats(const struct Stats* s, FILE* out, int json) {
+    const char* keys[] = { "nodes_traversed", "comparisons", "allocations", "frees",
+                           "bytes_live", "bytes_peak", "height", "queue_full", "queue_empty" };
+    long values[] = { s->nodesTraversed, s->comparisons, s->allocations, s->frees,
+                      s->bytesLive, s->bytesPeak, s->height, s->queueFull, s->queueEmpty };
+    int i, n = (int)(sizeof(values) / sizeof(values[0]));
+
+    if (json) {
+        fprintf(out, "{\"structure\": \"%s\"", s->name);
+        for (i = 0; i < n; i++)
+            fprintf(out, ", \"%s\": %ld", keys[i], values[i]);
+        fprintf(out, "}\n");
+    } else {
+        fprintf(out, "structure=%s\n", s->name);
+        for (i = 0; i < n; i++)
+            fprintf(out, "%s=%ld\n", keys[i], values[i]);
+    }
+}
+
+#define STATS_DEFINE(name)   struct Stats stats = { name, 0, 0, 0, 0, 0, 0, 0, 0, 0 }
+#define STAT_VISIT()         (stats.nodesTraversed++)
+#define STAT_CMP(expr)       (stats.comparisons++, (expr))
+#define STAT_ALLOC(bytes)    statAlloc(&stats, (long)(bytes))
+#define STAT_FREE(bytes)     statFree(&stats, (long)(bytes))
+#define STAT_HEIGHT(h)       (stats.height = (h))
+#define STAT_QUEUE_FULL()    (stats.queueFull++)
+#define STAT_QUEUE_EMPTY()   (stats.queueEmpty++)
+#define STATS_DUMP()         dumpStats(&stats, stdout, getenv("STATS_JSON") != NULL)
+
+#else
+
+#define STATS_DEFINE(name)   struct Stats
+#define STAT_VISIT()         ((void)0)
+#define STAT_CMP(expr)       (expr)
+#define STAT_ALLOC(bytes)    ((void)0)
+#define STAT_FREE(bytes)     ((void)0)
+#define STAT_HEIGHT(h)       ((void)0)
+#define STAT_QUEUE_FULL()    ((void)0)
+#define STAT_QUEUE_EMPTY()   ((void)0)
+#define STATS_DUMP()         ((void)0)
+
+#endif
+
+#endif
@@ -0,0 +1,473 @@
+#ifndef THREADPOOL_H
+#define THREADPOOL_H
+
+/* ------------------------- THREAD POOL -------------------------
+   A work-stealing task scheduler any program here can include
+   (compile with -pthread). 17_threadPool.c shows how to use it.
+
+   - Every worker thread owns a work-stealing deque (the Chase-Lev
+     deque of 16_workStealingDeque.c, holding task pointers). Tasks
+     a worker spawns go to the bottom of its own deque and it runs
+     them newest first.
+   - Idle workers steal the oldest task from a random other worker.
+   - Threads outside the pool submit through one global INJECTION
+     QUEUE, a growable circular queue like 04_cq.c under a mutex.
+
+   Fork-join API:
+       struct TaskGroup group;  struct Task task;
+       taskGroupInit(&group);
+       taskSpawn(pool, &task, function, arg, &group);
+       ... do other work ...
+       taskWait(pool, &group);        // runs other tasks while waiting
+   A struct Task is not copied. It may live in the spawner's stack
+   frame because taskWait does not return before the task is done,
+   so spawning never calls malloc.
+
+   parallelFor(pool, begin, end, grain, body, ctx) splits
+   [begin, end) in halves until pieces are at most 'grain' long and
+   calls body(lo, hi, ctx) on every piece in parallel.
+------------------------------------------------------------------*/
+
+#include <stdlib.h>
+#include <pthread.h>
+#include <sched.h>
+#include <stdatomic.h>
+#include <time.h>
+#include <unistd.h>
+
+#define POOL_MAX_WORKERS 64
+#define POOL_DEQUE_CAPACITY 256   // First buffer size of each worker deque
+#define POOL_SPIN_ROUNDS 64       // Idle rounds before a worker sleeps
+
+struct TaskGroup {
+    atomic_int pending;        // Spawned tasks that have not finished
+};
+
+struct Task {
+    void (*run)(void* arg);
+    void* arg;
+    struct TaskGroup* group;
+};
+
+/* ----------------- WORKER DEQUE (CHASE-LEV) ----------------- */
+
+struct TaskBuffer {
+    long mask;                      // Capacity - 1
+    struct TaskBuffer* retired;     // Older buffer this one replaced
+    _Atomic(struct Task*) items[];
+};
+
+struct TaskDeque {
+    atomic_long top;                // Thieves take here
+    atomic_long bottom;             // Owner pushes and pops here
+    _Atomic(struct TaskBuffer*) buffer;
+};
+
+static inline struct TaskBuffer* createTaskBuffer(long capacity) {
+    struct TaskBuffer* b = (struct TaskBuffer*)malloc(sizeof(struct TaskBuffer) +
+                                                      capacity * sizeof(struct Task*));
+    b->mask = capacity - 1;
+    b->retired = NULL;
+    return b;
+}
+
+static inline void initTaskDeque(struct TaskDeque* dq) {
+    atomic_init(&dq->top, 0);
+    atomic_init(&dq->bottom, 0);
+    atomic_init(&dq->buffer, createTaskBuffer(POOL_DEQUE_CAPACITY));
+}
+
+static inline void freeTaskDeque(struct TaskDeque* dq) {
+    struct TaskBuffer* b = atomic_load_explicit(&dq->buffer, memory_order_relaxed);
+    while (b != NULL) {
+        struct TaskBuffer* older = b->retired;
+        free(b);
+        b = older;
+    }
+}
+
+// Owner only
+static inline void dequePush(struct TaskDeque* dq, struct Task* task) {
+    long b = atomic_load_explicit(&dq->bottom, memory_order_relaxed);
+    long t = atomic_load_explicit(&dq->top, memory_order_acquire);
+    struct TaskBuffer* buf = atomic_load_explicit(&dq->buffer, memory_order_relaxed);
+
+    if (b - t > buf->mask) {
+        // Full: copy into a buffer twice the size (old one kept, see 16)
+        struct TaskBuffer* bigger = createTaskBuffer(2 * (buf->mask + 1));
+        long i;
+        for (i = t; i < b; i++)
+            atomic_store_explicit(&bigger->items[i & bigger->mask],
+                                  atomic_load_explicit(&buf->items[i & buf->mask], memory_order_relaxed),
+                                  memory_order_relaxed);
+        bigger->retired = buf;
+        atomic_store_explicit(&dq->buffer, bigger, memory_order_release);
+        buf = bigger;
+    }
+
+    atomic_store_explicit(&buf->items[b & buf->mask], task, memory_order_relaxed);
+    // A release store instead of 16's release fence: same cost, and it
+    // also publishes the task's fields in a way ThreadSanitizer sees
+    atomic_store_explicit(&dq->bottom, b + 1, memory_order_release);
+}
+
+// Owner only. Returns NULL if empty.
+static inline struct Task* dequePop(struct TaskDeque* dq) {
+    long b = atomic_load_explicit(&dq->bottom, memory_order_relaxed) - 1;
+    struct TaskBuffer* buf = atomic_load_explicit(&dq->buffer, memory_order_relaxed);
+    struct Task* task = NULL;
+    long t;
+
+    atomic_store_explicit(&dq->bottom, b, memory_order_relaxed);
+    atomic_thread_fence(memory_order_seq_cst);
+    t = atomic_load_explicit(&dq->top, memory_order_relaxed);
+
+    if (t <= b) {
+        task = atomic_load_explicit(&buf->items[b & buf->mask], memory_order_relaxed);
+        if (t == b) {
+            if (!atomic_compare_exchange_strong_explicit(&dq->top, &t, t + 1,
+                                                         memory_order_seq_cst, memory_order_relaxed))
+                task = NULL;
+            atomic_store_explicit(&dq->bottom, b + 1, memory_order_relaxed);
+        }
+    } else {
+        atomic_store_explicit(&dq->bottom, b + 1, memory_order_relaxed);
+    }
+    return task;
+}
+
+// Any thread. Returns NULL if empty or if another thread won the race.
+static inline struct Task* dequeSteal(struct TaskDeque* dq) {
+    long t = atomic_load_explicit(&dq->top, memory_order_acquire);
+    atomic_thread_fence(memory_order_seq_cst);
+    long b = atomic_load_explicit(&dq->bottom, memory_order_acquire);
+
+    if (t >= b)
+        return NULL;
+
+    struct TaskBuffer* buf = atomic_load_explicit(&dq->buffer, memory_order_acquire);
+    struct Task* task = atomic_load_explicit(&buf->items[t & buf->mask], memory_order_relaxed);
+    if (!atomic_compare_exchange_strong_explicit(&dq->top, &t, t + 1,
+                                                 memory_order_seq_cst, memory_order_relaxed))
+        return NULL;
+    return task;
+}
+
+/* ---------------------- THE POOL ITSELF ---------------------- */
+
+struct ThreadPool;
+
+struct PoolWorker {
+    _Alignas(64) struct ThreadPool* pool;   // Own cache line per worker
+    int id;
+    unsigned seed;              // For picking steal victims
+    struct TaskDeque deque;
+    long executed;              // Tasks this worker ran
+    long stolen;                // ... of which it stole
+};
+
+struct ThreadPool {
+    int size;                   // Number of worker threads
+    struct PoolWorker workers[POOL_MAX_WORKERS];
+    pthread_t threads[POOL_MAX_WORKERS];
+
+    // Global injection queue: circular, grows when full
+    pthread_mutex_t lock;
+    struct Task** injected;
+    int injectFront;
+    atomic_int injectCount;     // Read without the lock as a hint
+    int injectCapacity;
+
+    pthread_cond_t wake;        // Signalled when work arrives
+    atomic_int sleepers;        // Workers waiting on 'wake'
+    atomic_int shutdown;
+};
+
+// The worker running on this thread, or NULL outside any pool
+static _Thread_local struct PoolWorker* currentWorker = NULL;
+
+static inline void taskGroupInit(struct TaskGroup* group) {
+    atomic_init(&group->pending, 0);
+}
+
+static inline void wakeWorker(struct ThreadPool* pool) {
+    if (atomic_load_explicit(&pool->sleepers, memory_order_relaxed) > 0) {
+        pthread_mutex_lock(&pool->lock);
+        pthread_cond_signal(&pool->wake);
+        pthread_mutex_unlock(&pool->lock);
+    }
+}
+
+static inline void injectTask(struct ThreadPool* pool, struct Task* task) {
+    pthread_mutex_lock(&pool->lock);
+    if (pool->injectCount == pool->injectCapacity) {
+        // Unroll the circle into an array twice the size
+        struct Task** bigger = (struct Task**)malloc(2 * pool->injectCapacity * sizeof(struct Task*));
+        int i;
+        for (i = 0; i < pool->injectCount; i++)
+            bigger[i] = pool->injected[(pool->injectFront + i) % pool->injectCapacity];
+        free(pool->injected);
+        pool->injected = bigger;
+        pool->injectFront = 0;
+        pool->injectCapacity *= 2;
+    }
+    pool->injected[(pool->injectFront + pool->injectCount) % pool->injectCapacity] = task;
+    pool->injectCount++;
+    pthread_cond_signal(&pool->wake);
+    pthread_mutex_unlock(&pool->lock);
+}
+
+static inline struct Task* takeInjected(struct ThreadPool* pool) {
+    struct Task* task = NULL;
+
+    pthread_mutex_lock(&pool->lock);
+    if (pool->injectCount > 0) {
+        task = pool->injected[pool->injectFront];
+        pool->injectFront = (pool->injectFront + 1) % pool->injectCapacity;
+        pool->injectCount--;
+    }
+    pthread_mutex_unlock(&pool->lock);
+    return task;
+}
+
+// Next task for a worker ('self') or for an outside thread (NULL):
+// own deque first, then the injection queue, then stealing
+static inline struct Task* findTask(struct ThreadPool* pool, struct PoolWorker* self) {
+    struct Task* task;
+    int start, i;
+
+    if (self != NULL && (task = dequePop(&self->deque)) != NULL)
+        return task;
+    // Unlocked peek: only take the mutex when something is queued
+    if (atomic_load_explicit(&pool->injectCount, memory_order_relaxed) > 0 && (task = takeInjected(pool)) != NULL)
+        return task;
+
+    start = self != NULL ? (int)(rand_r(&self->seed) % pool->size) : 0;
+    for (i = 0; i < pool->size; i++) {
+        struct PoolWorker* victim = &pool->workers[(start + i) % pool->size];
+        if (victim != self && (task = dequeSteal(&victim->deque)) != NULL) {
+            if (self != NULL)
+                self->stolen++;
+            return task;
+        }
+    }
+    return NULL;
+}
+
+static inline void runTask(struct PoolWorker* self, struct Task* task) {
+    // Read the group first: once pending drops, 'task' may be gone
+    struct TaskGroup* group = task->group;
+
+    task->run(task->arg);
+    if (self != NULL)
+        self->executed++;
+    atomic_fetch_sub_explicit(&group->pending, 1, memory_order_release);
+}
+
+// Queues 'task' to call run(arg) as part of 'group'. From a worker the
+// task goes on its own deque, from any other thread to the injection
+// queue. 'task' must stay alive until taskWait on the group returns.
+static inline void taskSpawn(struct ThreadPool* pool, struct Task* task,
+                             void (*run)(void*), void* arg, struct TaskGroup* group) {
+    task->run = run;
+    task->arg = arg;
+    task->group = group;
+    atomic_fetch_add_explicit(&group->pending, 1, memory_order_relaxed);
+
+    if (currentWorker != NULL && currentWorker->pool == pool) {
+        dequePush(&currentWorker->deque, task);
+        wakeWorker(pool);
+    } else {
+        injectTask(pool, task);
+    }
+}
+
+// Returns when every task spawned in 'group' has finished. A worker
+// runs other tasks meanwhile; an outside thread only waits, so the
+// pool size alone decides how many threads do the work.
+static inline void taskWait(struct ThreadPool* pool, struct TaskGroup* group) {
+    struct PoolWorker* self = (currentWorker != NULL && currentWorker->pool == pool) ? currentWorker : NULL;
+    int idle = 0;
+
+    while (atomic_load_explicit(&group->pending, memory_order_acquire) > 0) {
+        struct Task* task = self != NULL ? findTask(pool, self) : NULL;
+        if (task != NULL) {
+            runTask(self, task);
+            idle = 0;
+        } else if (++idle < POOL_SPIN_ROUNDS) {
+            sched_yield();
+        } else {
+            struct timespec pause = { 0, 50000 };   // 50 microseconds
+            nanosleep(&pause, NULL);
+        }
+    }
+}
+
+static inline void* poolWorkerMain(void* arg) {
+    struct PoolWorker* self = (struct PoolWorker*)arg;
+    struct ThreadPool* pool = self->pool;
+    int idle = 0;
+
+    currentWorker = self;
+    while (!atomic_load_explicit(&pool->shutdown, memory_order_acquire)) {
+        struct Task* task = findTask(pool, self);
+        if (task != NULL) {
+            runTask(self, task);
+            idle = 0;
+        } else if (++idle < POOL_SPIN_ROUNDS) {
+            sched_yield();
+        } else {
+            // Sleep until work is injected. Local spawns only signal
+            // when someone sleeps, so also wake up every millisecond
+            // rather than miss one.
+            struct timespec until;
+            clock_gettime(CLOCK_REALTIME, &until);
+            until.tv_nsec += 1000000;
+            if (until.tv_nsec >= 1000000000) {
+                until.tv_sec++;
+                until.tv_nsec -= 1000000000;
+            }
+            pthread_mutex_lock(&pool->lock);
+            atomic_fetch_add(&pool->sleepers, 1);
+            if (pool->injectCount == 0 && !atomic_load(&pool->shutdown))
+                pthread_cond_timedwait(&pool->wake, &pool->lock, &until);
+            atomic_fetch_sub(&pool->sleepers, 1);
+            pthread_mutex_unlock(&pool->lock);
+            idle = 0;
+        }
+    }
+    currentWorker = NULL;
+    return NULL;
+}
+
+// Starts 'workers' threads, or one per online CPU if workers <= 0
+static inline void createThreadPool(struct ThreadPool* pool, int workers) {
+    int i;
+
+    if (workers <= 0) {
+        long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+        workers = cpus < 1 ? 1 : (int)cpus;
+    }
+    if (workers > POOL_MAX_WORKERS)
+        workers = POOL_MAX_WORKERS;
+
+    pool->size = workers;
+    pthread_mutex_init(&pool->lock, NULL);
+    pthread_cond_init(&pool->wake, NULL);
+    pool->injectCapacity = 64;
+    pool->injected = (struct Task**)malloc(pool->injectCapacity * sizeof(struct Task*));
+    pool->injectFront = 0;
+    atomic_init(&pool->injectCount, 0);
+    atomic_init(&pool->sleepers, 0);
+    atomic_init(&pool->shutdown, 0);
+
+    for (i = 0; i < workers; i++) {
+        struct PoolWorker* w = &pool->workers[i];
+        w->pool = pool;
+        w->id = i;
+        w->seed = 12345u + (unsigned)i;
+        w->executed = w->stolen = 0;
+        initTaskDeque(&w->deque);
+    }
+    for (i = 0; i < workers; i++)
+        pthread_create(&pool->threads[i], NULL, poolWorkerMain, &pool->workers[i]);
+}
+
+// Stops the workers. All task groups must have been waited for.
+static inline void destroyThreadPool(struct ThreadPool* pool) {
+    int i;
+
+    pthread_mutex_lock(&pool->lock);
+    atomic_store(&pool->shutdown, 1);
+    pthread_cond_broadcast(&pool->wake);
+    pthread_mutex_unlock(&pool->lock);
+
+    for (i = 0; i < pool->size; i++) {
+        pthread_join(pool->threads[i], NULL);
+        freeTaskDeque(&pool->workers[i].deque);
+    }
+    free(pool->injected);
+    pthread_mutex_destroy(&pool->lock);
+    pthread_cond_destroy(&pool->wake);
+}
+
+/* ------------------------ PARALLEL FOR ------------------------ */
+
+struct ForRange {
+    struct ThreadPool* pool;
+    long begin, end, grain;
+    void (*body)(long lo, long hi, void* ctx);
+    void* ctx;
+};
+
+// Keeps the left half and spawns the right half until the piece is
+// small enough, runs it, then waits for the spawned halves
+static inline void forRangeRun(void* arg) {
+    struct ForRange* range = (struct ForRange*)arg;
+    struct ForRange right[64];       // 64 halvings cover any long range
+    struct Task tasks[64];
+    struct TaskGroup group;
+    long lo = range->begin, hi = range->end;
+    int n = 0;
+
+    taskGroupInit(&group);
+    while (hi - lo > range->grain && n < 64) {
+        long mid = lo + (hi - lo) / 2;
+        right[n] = *range;
+        right[n].begin = mid;
+        right[n].end = hi;
+        taskSpawn(range->pool, &tasks[n], forRangeRun, &right[n], &group);
+        n++;
+        hi = mid;
+    }
+    range->body(lo, hi, range->ctx);
+    taskWait(range->pool, &group);
+}
+
+// Calls body(lo, hi, ctx) over pieces covering [begin, end) in
+// parallel and returns when all are done. grain <= 0 picks a grain
+// giving about 8 pieces per worker.
+static inline void parallelFor(struct ThreadPool* pool, long begin, long end, long grain,
+                               void (*body)(long lo, long hi, void* ctx), void* ctx) {
+    struct ForRange range;
+
+    if (end <= begin)
+        return;
+    if (grain <= 0) {
+        grain = (end - begin) / (8L * pool->size);
+        if (grain < 1)
+            grain = 1;
+    }
+
+    range.pool = pool;
+    range.begin = begin;
+    range.end = end;
+    range.grain = grain;
+    range.body = body;
+    range.ctx = ctx;
+
+    if (currentWorker != NULL && currentWorker->pool == pool) {
+        forRangeRun(&range);
+    } else {
+        // Hand the whole range to the pool and wait for it
+        struct TaskGroup group;
+        struct Task task;
+        taskGroupInit(&group);
+        taskSpawn(pool, &task, forRangeRun, &range, &group);
+        taskWait(pool, &group);
+    }
+}
+
+// Runs run(arg) on the pool and waits for it (and everything it
+// spawns and waits for) to finish. Useful as the root of a fork-join
+// computation started from main().
+static inline void poolRun(struct ThreadPool* pool, void (*run)(void*), void* arg) {
+    struct TaskGroup group;
+    struct Task task;
+
+    taskGroupInit(&group);
+    taskSpawn(pool, &task, run, arg, &group);
+    taskWait(pool, &group);
+}
+
+#endif
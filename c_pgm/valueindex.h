@@ -0,0 +1,162 @@
+#ifndef VALUEINDEX_H
+#define VALUEINDEX_H
+
+/* ------------------------ VALUE INDEX ------------------------
+   Open-addressing hash table (linear probing) from a value to the
+   place that holds it, so "find value" is expected O(1) instead of
+   a scan. Duplicate values are allowed, so there is one (value, ref)
+   entry per element. The program keeps it in sync on every insert
+   and delete. Removal shifts later entries back (no tombstones).
+
+   What an entry refers to is chosen by the program: define
+   INDEX_REF (its type) and INDEX_EMPTY (the value that marks a free
+   bucket) before the #include. The default is a node pointer:
+       #define INDEX_REF   int    // array slot, as in 08_arrayBinaryTree.c
+       #define INDEX_EMPTY -1
+       #include "valueindex.h"
+   Each structure owns its own ValueIndex (in its list or tree
+   handle), so several of them can exist at the same time.
+----------------------------------------------------------------*/
+
+#include <stdlib.h>
+
+#ifndef INDEX_REF
+#define INDEX_REF   struct Node*
+#define INDEX_EMPTY NULL
+#endif
+
+// Value comparisons are counted when instrument.h is included first
+#ifdef STAT_CMP
+#define INDEX_CMP(expr) STAT_CMP(expr)
+#else
+#define INDEX_CMP(expr) (expr)
+#endif
+
+struct IndexEntry {
+    int value;
+    INDEX_REF ref;      // INDEX_EMPTY means the bucket is empty
+};
+
+struct ValueIndex {
+    struct IndexEntry* entries;
+    int capacity;       // Always a power of two, at least 2
+    int shift;          // 32 - log2(capacity)
+    int count;
+};
+
+// Home bucket of a value (Fibonacci hashing). The top bits of the
+// product depend on every bit of the value; the low bits do not, so
+// masking them would put values that differ only in their high bits
+// (multiples of 65536, say) in the same few buckets.
+static inline unsigned hashValue(const struct ValueIndex* index, int value) {
+    return ((unsigned)value * 2654435769u) >> index->shift;
+}
+
+static inline void initIndex(struct ValueIndex* index, int capacity) {
+    int i;
+    index->entries = (struct IndexEntry*)malloc(capacity * sizeof(struct IndexEntry));
+    index->capacity = capacity;
+    index->shift = 32;
+    while ((1 << (32 - index->shift)) < capacity)
+        index->shift--;
+    index->count = 0;
+    for (i = 0; i < capacity; i++)
+        index->entries[i].ref = INDEX_EMPTY;
+}
+
+static inline void freeIndex(struct ValueIndex* index) {
+    free(index->entries);
+    index->entries = NULL;
+    index->capacity = 0;
+    index->count = 0;
+}
+
+static inline void indexInsert(struct ValueIndex* index, int value, INDEX_REF ref);
+
+// Doubles the table and re-inserts every entry
+static inline void growIndex(struct ValueIndex* index) {
+    struct IndexEntry* old = index->entries;
+    int oldCapacity = index->capacity, i;
+
+    initIndex(index, oldCapacity * 2);
+    for (i = 0; i < oldCapacity; i++)
+        if (old[i].ref != INDEX_EMPTY)
+            indexInsert(index, old[i].value, old[i].ref);
+    free(old);
+}
+
+// Adds the entry (value, ref); keeps the load factor at most 1/2
+static inline void indexInsert(struct ValueIndex* index, int value, INDEX_REF ref) {
+    if (2 * (index->count + 1) > index->capacity)
+        growIndex(index);
+
+    unsigned mask = index->capacity - 1;
+    unsigned i = hashValue(index, value);
+    while (index->entries[i].ref != INDEX_EMPTY)
+        i = (i + 1) & mask;
+
+    index->entries[i].value = value;
+    index->entries[i].ref = ref;
+    index->count++;
+}
+
+// Returns the bucket holding 'value' (for 'ref', or for any ref if
+// ref is INDEX_EMPTY), or -1 if there is none
+static inline int indexLookup(const struct ValueIndex* index, int value, INDEX_REF ref) {
+    unsigned mask = index->capacity - 1;
+    unsigned i = hashValue(index, value);
+
+    while (index->entries[i].ref != INDEX_EMPTY) {
+        if (INDEX_CMP(index->entries[i].value == value) &&
+            (ref == INDEX_EMPTY || index->entries[i].ref == ref))
+            return (int)i;
+        i = (i + 1) & mask;
+    }
+    return -1;
+}
+
+// Returns the next bucket after 'bucket' that holds 'value' (for any
+// ref), or -1 if there is none. Starting from indexLookup, this
+// visits every entry of a value: they all sit in the run of full
+// buckets that follows the value's home bucket.
+static inline int indexNext(const struct ValueIndex* index, int value, int bucket) {
+    unsigned mask = index->capacity - 1;
+    unsigned i = ((unsigned)bucket + 1) & mask;
+
+    while (index->entries[i].ref != INDEX_EMPTY) {
+        if (INDEX_CMP(index->entries[i].value == value))
+            return (int)i;
+        i = (i + 1) & mask;
+    }
+    return -1;
+}
+
+// Empties a bucket, then moves back every following entry that
+// would no longer be reachable from its home bucket
+static inline void indexRemoveAt(struct ValueIndex* index, int bucket) {
+    unsigned mask = index->capacity - 1;
+    unsigned hole = (unsigned)bucket;
+    unsigned i = (hole + 1) & mask;
+
+    while (index->entries[i].ref != INDEX_EMPTY) {
+        unsigned home = hashValue(index, index->entries[i].value);
+        // Entry may fill the hole if its home is not in (hole, i]
+        if (((i - home) & mask) >= ((i - hole) & mask)) {
+            index->entries[hole] = index->entries[i];
+            hole = i;
+        }
+        i = (i + 1) & mask;
+    }
+
+    index->entries[hole].ref = INDEX_EMPTY;
+    index->count--;
+}
+
+// Removes the entry of an element that is about to go away
+static inline void indexRemove(struct ValueIndex* index, int value, INDEX_REF ref) {
+    int bucket = indexLookup(index, value, ref);
+    if (bucket != -1)
+        indexRemoveAt(index, bucket);
+}
+
+#endif